@@ -147,10 +147,11 @@ SFML_GRAPHICS_API bool operator !=(const BlendMode& left, const BlendMode& right
 ////////////////////////////////////////////////////////////
 // Commonly used blending modes
 ////////////////////////////////////////////////////////////
-SFML_GRAPHICS_API extern const BlendMode BlendAlpha;    //!< Blend source and dest according to dest alpha
-SFML_GRAPHICS_API extern const BlendMode BlendAdd;      //!< Add source to dest
-SFML_GRAPHICS_API extern const BlendMode BlendMultiply; //!< Multiply source and dest
-SFML_GRAPHICS_API extern const BlendMode BlendNone;     //!< Overwrite dest with source
+SFML_GRAPHICS_API extern const BlendMode BlendAlpha;              //!< Blend source and dest according to dest alpha
+SFML_GRAPHICS_API extern const BlendMode BlendAdd;                //!< Add source to dest
+SFML_GRAPHICS_API extern const BlendMode BlendMultiply;           //!< Multiply source and dest
+SFML_GRAPHICS_API extern const BlendMode BlendNone;               //!< Overwrite dest with source
+SFML_GRAPHICS_API extern const BlendMode BlendPremultipliedAlpha; //!< Blend source with premultiplied alpha over dest
 
 } // namespace sf
 
@@ -204,8 +205,19 @@ SFML_GRAPHICS_API extern const BlendMode BlendNone;     //!< Overwrite dest with
 /// sf::BlendMode additiveBlending       = sf::BlendAdd;
 /// sf::BlendMode multiplicativeBlending = sf::BlendMultiply;
 /// sf::BlendMode noBlending             = sf::BlendNone;
+/// sf::BlendMode premultipliedBlending  = sf::BlendPremultipliedAlpha;
 /// \endcode
 ///
+/// sf::BlendPremultipliedAlpha expects source colors whose
+/// components are already multiplied by their alpha, as
+/// produced by sf::Image::premultiplyAlpha or by textures
+/// with sf::Texture::setPremultipliedAlpha enabled. Filtering
+/// and mipmapping such textures doesn't bleed the color of
+/// transparent pixels into their neighbours, and the content
+/// of a sf::RenderTexture that was cleared to transparent and
+/// drawn with this mode is itself premultiplied, so it can be
+/// composited with the same mode without any correction pass.
+///
 /// In SFML, a blend mode can be specified every time you draw a sf::Drawable
 /// object to a render target. It is part of the sf::RenderStates compound
 /// that is passed to the member function sf::RenderTarget::draw().
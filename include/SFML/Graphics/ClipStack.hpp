@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_CLIPSTACK_HPP
+#define SFML_CLIPSTACK_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Drawable;
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Stack of nested clipping regions applied to
+///        a render target
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ClipStack : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty clip stack for a render target
+    ///
+    /// \param target Render target to clip
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ClipStack(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restrict rendering to a rectangle
+    ///
+    /// The new clipping region is the intersection of the
+    /// rectangle with the current clipping region. If the
+    /// transformed rectangle is aligned with the pixels of the
+    /// target, it is applied with the scissor rectangle of the
+    /// target's view and doesn't touch the stencil buffer.
+    /// Otherwise it is drawn into the stencil buffer like
+    /// any other shape.
+    ///
+    /// \param rectangle Rectangle, in local coordinates
+    /// \param transform Transform applied to the rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(const FloatRect& rectangle, const Transform& transform = Transform::Identity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restrict rendering to the area covered by a drawable
+    ///
+    /// The new clipping region is the intersection of the
+    /// pixels covered by the drawable with the current clipping
+    /// region. The drawable is drawn into the stencil buffer,
+    /// and drawn again when the clip is popped, so it must
+    /// stay alive and unchanged until then. Rectangles should
+    /// rather be pushed with push(const FloatRect&, const Transform&),
+    /// which can avoid the stencil buffer entirely.
+    ///
+    /// The blend mode, texture, shader and stencil mode of
+    /// \a states are ignored.
+    ///
+    /// \param drawable Drawable defining the clipping region
+    /// \param states   Render states to draw the drawable with
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(const Drawable& drawable, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restore the clipping region that was active
+    ///        before the last push
+    ///
+    /// This function does nothing if the stack is empty.
+    ///
+    ////////////////////////////////////////////////////////////
+    void pop();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of clips in the stack
+    ///
+    /// \return Number of pushed clips that haven't been popped
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getDepth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the stencil mode that restricts drawing
+    ///        to the current clipping region
+    ///
+    /// When the stack only contains rectangles applied with the
+    /// scissor, the default (disabled) stencil mode is returned.
+    /// All the draws made at the same depth share the same
+    /// stencil mode, so that they don't cause any stencil state
+    /// change and can be batched together.
+    ///
+    /// \return Stencil mode to draw the clipped content with
+    ///
+    ////////////////////////////////////////////////////////////
+    StencilMode getStencilMode() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a drawable inside the current clipping region
+    ///
+    /// The stencil mode of \a states is replaced by the one
+    /// returned by getStencilMode().
+    ///
+    /// \param drawable Object to draw
+    /// \param states   Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Drawable& drawable, const RenderStates& states = RenderStates::Default);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief A single clip of the stack
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Clip
+    {
+        bool            stencil;         //!< Is the clip drawn into the stencil buffer?
+        FloatRect       previousScissor; //!< Scissor rectangle of the view before a scissor clip was pushed
+        const Drawable* drawable;        //!< Drawable of a stencil clip, NULL if the clip is a quad
+        RenderStates    states;          //!< Render states of the stencil clip
+        Vertex          quad[4];         //!< Vertices of a stencil clip made of a rectangle
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the geometry of a stencil clip
+    ///
+    /// \param clip      Clip to draw
+    /// \param operation Stencil update operation to draw with
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawStencilClip(const Clip& clip, StencilMode::UpdateOperation operation);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    RenderTarget&     m_target;       //!< Render target the clips are applied to
+    std::vector<Clip> m_clips;        //!< Pushed clips, from the outermost to the innermost
+    unsigned int      m_stencilDepth; //!< Number of stencil clips in the stack, reference value of the clipped draws
+};
+
+} // namespace sf
+
+
+#endif // SFML_CLIPSTACK_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ClipStack
+/// \ingroup graphics
+///
+/// sf::ClipStack restricts rendering to nested regions of a
+/// render target, as needed by user interfaces where panels,
+/// scroll areas and widgets clip their children. Each push
+/// intersects the current clipping region with a new one,
+/// and each pop restores the previous region.
+///
+/// Rectangles that map to axis-aligned pixel rectangles are
+/// the most common case, and are applied through the scissor
+/// rectangle of the target's view (see sf::View::setScissor):
+/// they cost no draw call and don't need a stencil buffer.
+/// Other regions, such as rounded panels or rotated
+/// rectangles, are drawn into the stencil buffer: each of
+/// them increments the stencil value of the pixels it covers
+/// inside the current region, so the stencil value of a
+/// pixel equals the number of nested regions that contain
+/// it, and the clipped content is drawn with a stencil test
+/// against that number. Popping a region draws it again
+/// with a decrement, which leaves the stencil buffer as it
+/// was before the push without clearing it.
+///
+/// Since the reference value only changes on push and pop,
+/// consecutive widgets drawn at the same depth use identical
+/// render states and don't trigger any stencil state change.
+///
+/// Stencil regions require a stencil buffer, which must be
+/// requested in the sf::ContextSettings of the target and
+/// cleared to 0 at the beginning of the frame. The number of
+/// nested stencil regions is limited by the number of stencil
+/// bits, 255 with an 8-bit stencil buffer. Changes made to
+/// the view of the target while clips are pushed are kept,
+/// except for its scissor rectangle which is restored on pop.
+///
+/// The target can be an sf::CommandList, in which case the
+/// clips are recorded along with the other commands.
+///
+/// Usage example:
+/// \code
+/// sf::ClipStack clips(window);
+///
+/// window.clear();
+///
+/// clips.push(panelBounds);
+/// clips.draw(panelBackground);
+///
+/// clips.push(roundedFrame);
+/// clips.draw(thumbnail);
+/// clips.pop();
+///
+/// clips.pop();
+///
+/// window.display();
+/// \endcode
+///
+/// \see sf::StencilMode, sf::View
+///
+////////////////////////////////////////////////////////////
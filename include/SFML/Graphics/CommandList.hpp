@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_COMMANDLIST_HPP
+#define SFML_COMMANDLIST_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Render target that records draw commands for
+///        later submission to another render target
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API CommandList : public RenderTarget
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty command list whose default view
+    /// covers a zero-sized area.
+    ///
+    ////////////////////////////////////////////////////////////
+    CommandList();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty command list for a given target size
+    ///
+    /// The size is only used to compute the default view of
+    /// the command list and to map coordinates; it should
+    /// match the size of the target the list will be
+    /// submitted to.
+    ///
+    /// \param size Size of the target the list is recorded for
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit CommandList(const Vector2u& size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the recorded commands
+    ///
+    /// The memory allocated for the commands and vertices is
+    /// kept, so that a list can be recorded again every frame
+    /// without reallocating.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of recorded commands
+    ///
+    /// Consecutive draws that share the same render states
+    /// are merged into a single command while recording, so
+    /// this is the number of draw calls the list will issue
+    /// when it is submitted.
+    ///
+    /// \return Number of commands in the list
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCommandCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of vertices stored in the list
+    ///
+    /// \return Number of vertices copied into the list
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getVertexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the target the list is recorded for
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate or deactivate the command list for rendering
+    ///
+    /// A command list has no OpenGL context, so this function
+    /// always fails.
+    ///
+    /// \param active Ignored
+    ///
+    /// \return Always false
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool setActive(bool active = true);
+
+private:
+
+    friend class RenderTarget;
+    friend class DrawQueue;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of recorded commands
+    ///
+    ////////////////////////////////////////////////////////////
+    enum CommandType
+    {
+        DrawVertices,     //!< Draw vertices stored in the list
+        DrawVertexBuffer, //!< Draw a range of a vertex buffer
+        ClearColor,       //!< Clear the color buffer
+        ClearStencil,     //!< Clear the stencil buffer
+        ClearBoth,        //!< Clear the color and stencil buffers
+        SetView           //!< Change the view of the target
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief A single recorded command
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Command
+    {
+        CommandType         type;          //!< Type of the command
+        PrimitiveType       primitiveType; //!< Type of primitives to draw
+        RenderStates        states;        //!< Render states to draw with
+        std::size_t         first;         //!< Index of the first vertex, or of the view
+        std::size_t         count;         //!< Number of vertices to draw
+        const VertexBuffer* vertexBuffer;  //!< Vertex buffer to draw
+        Color               color;         //!< Clear color
+        unsigned int        stencilValue;  //!< Stencil clear value
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a draw of an array of vertices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordDraw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a draw of a range of a vertex buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param firstVertex  Index of the first vertex to render
+    /// \param vertexCount  Number of vertices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordDraw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a clear of the target
+    ///
+    /// \param type  ClearColor, ClearStencil or ClearBoth
+    /// \param color Fill color
+    /// \param value Stencil value
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordClear(CommandType type, const Color& color, unsigned int value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the current view if it changed since the last command
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordView();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replay the recorded commands on a render target
+    ///
+    /// \param target Render target to replay the commands on
+    ///
+    ////////////////////////////////////////////////////////////
+    void replay(RenderTarget& target) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u             m_size;         //!< Size of the target the list is recorded for
+    std::vector<Command> m_commands;     //!< Recorded commands, in submission order
+    std::vector<Vertex>  m_vertices;     //!< Arena holding the pre-transformed vertices of all the draws
+    std::vector<View>    m_views;        //!< Views set while recording
+    std::size_t          m_mergeBarrier; //!< Index of the first command that new draws may be merged into
+};
+
+} // namespace sf
+
+
+#endif // SFML_COMMANDLIST_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CommandList
+/// \ingroup graphics
+///
+/// sf::CommandList is a render target that doesn't render
+/// anything: every draw, clear and view change is recorded
+/// into the list, and the whole list is later replayed on a
+/// real target with sf::RenderTarget::submit.
+///
+/// Unlike other render targets, a command list doesn't own
+/// an OpenGL context, which means that it can be filled from
+/// any thread. This makes it possible to traverse a scene on
+/// several worker threads, each one recording its own list,
+/// and to submit the lists in order on the rendering thread.
+///
+/// When a draw is recorded, its vertices are copied into the
+/// list and transformed by the transform of the render
+/// states, which are captured by value. Consecutive draws
+/// that use the same primitive type, texture, shader, blend
+/// mode and stencil mode are merged into a single command,
+/// so that a list made of many sprites sharing a texture is
+/// submitted as one draw call. Strips and fans can't be
+/// merged and always produce their own command. Draws of
+/// sf::VertexBuffer objects only store a reference to the
+/// buffer, which must stay alive until the list has been
+/// submitted.
+///
+/// Textures, shaders and vertex buffers referenced by a list
+/// are only read on the rendering thread during submission.
+/// Drawables whose draw function creates or updates OpenGL
+/// resources (for example sf::Text when it needs glyphs that
+/// aren't loaded yet) must not be recorded from a thread
+/// other than the rendering thread, unless their resources
+/// have been prepared beforehand.
+///
+/// Functions that interact with OpenGL directly, such as
+/// pushGLStates or resetGLStates, have no effect on a
+/// command list.
+///
+/// Usage example:
+/// \code
+/// // On a worker thread
+/// sf::CommandList list(window.getSize());
+/// list.reset();
+/// for (std::size_t i = 0; i < sprites.size(); ++i)
+///     list.draw(sprites[i]);
+///
+/// // On the rendering thread, once the worker is done
+/// window.clear();
+/// window.submit(list);
+/// window.display();
+/// \endcode
+///
+/// \see sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
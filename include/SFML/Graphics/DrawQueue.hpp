@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_DRAWQUEUE_HPP
+#define SFML_DRAWQUEUE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/CommandList.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Retained queue of draws that are sorted by layer
+///        and render states before being executed
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API DrawQueue : public Drawable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Ordering constraints of a queued draw
+    ///
+    ////////////////////////////////////////////////////////////
+    enum Ordering
+    {
+        Ordered,  //!< The draw is executed in submission order relative to the other ordered draws of its layer
+        Unordered //!< The draw doesn't overlap other draws of its layer, it can be reordered to reduce state changes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty queue.
+    ///
+    ////////////////////////////////////////////////////////////
+    DrawQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a drawable object
+    ///
+    /// The geometry produced by the drawable is copied into
+    /// the queue, so the drawable doesn't have to stay alive.
+    ///
+    /// \param drawable Object to queue
+    /// \param layer    Layer of the draw, lower layers are drawn first
+    /// \param states   Render states to use for drawing
+    /// \param ordering Ordering constraints of the draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const Drawable& drawable, int layer, const RenderStates& states = RenderStates::Default, Ordering ordering = Ordered);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue primitives defined by an array of vertices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param layer       Layer of the draw, lower layers are drawn first
+    /// \param states      Render states to use for drawing
+    /// \param ordering    Ordering constraints of the draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, int layer,
+             const RenderStates& states = RenderStates::Default, Ordering ordering = Ordered);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the queued draws
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of queued draws
+    ///
+    /// A drawable that issues several draws of its own, such
+    /// as sf::Text with an outline, counts as several draws.
+    ///
+    /// \return Number of draws in the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getDrawCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of draw calls the queue issues
+    ///
+    /// Consecutive draws that end up sharing the same render
+    /// states after sorting are merged into a single draw
+    /// call. This function sorts the queue if needed.
+    ///
+    /// \return Number of draw calls issued when drawing the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getDrawCallCount() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the queue to a render target
+    ///
+    /// Only the transform of \a states is applied, every
+    /// queued draw keeps its own texture, shader, blend mode
+    /// and stencil mode.
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the entries of newly recorded draws
+    ///
+    /// \param first    Index of the first command recorded by the draw
+    /// \param layer    Layer of the draw
+    /// \param ordering Ordering constraints of the draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void addEntries(std::size_t first, int layer, Ordering ordering);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort the queued draws and merge them into the sorted list
+    ///
+    /// \param transform Transform to apply to the whole queue
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const Transform& transform) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief A queued draw
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        int         layer;    //!< Layer of the draw
+        Ordering    ordering; //!< Ordering constraints of the draw
+        std::size_t command;  //!< Index of the draw in the recorded list, also its submission order
+        std::size_t group;    //!< Index of the first draw added by the same call, whose states are used for sorting
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    CommandList         m_recorded;        //!< Draws in submission order
+    std::vector<Entry>  m_entries;         //!< Sort keys of the recorded draws
+    mutable CommandList m_sorted;          //!< Draws in execution order, merged where possible
+    mutable Transform   m_sortedTransform; //!< Transform the sorted list was built with
+    mutable bool        m_needUpdate;      //!< Does the sorted list need to be rebuilt?
+};
+
+} // namespace sf
+
+
+#endif // SFML_DRAWQUEUE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::DrawQueue
+/// \ingroup graphics
+///
+/// sf::DrawQueue collects draws, each one tagged with a layer,
+/// and executes them sorted so that the render target has to
+/// change as few states as possible.
+///
+/// Layers are executed in increasing order. Within a layer,
+/// draws added as sf::DrawQueue::Unordered are executed first,
+/// grouped by shader, texture, blend mode and stencil mode,
+/// then draws added as sf::DrawQueue::Ordered are executed in
+/// the order they were added, which keeps alpha blending
+/// correct for overlapping geometry. Consecutive draws that
+/// end up with the same render states are merged into a
+/// single draw call, like in sf::CommandList. The draws issued
+/// by a single drawable, such as the fill and outline of a
+/// shape, always stay together and in their original order.
+///
+/// Only use sf::DrawQueue::Unordered for geometry whose result
+/// doesn't depend on the order it is drawn in, for instance
+/// opaque tiles that don't overlap each other, or draws that
+/// don't depend on each other's stencil writes.
+///
+/// The queue is retained: its geometry is copied when it is
+/// added, and the sorted result is kept until the queue is
+/// modified, so a queue can be built once and drawn every
+/// frame for the cost of its merged draw calls.
+///
+/// Like sf::CommandList, a queue can be filled from any thread,
+/// but it must be drawn from the thread that renders to the
+/// target.
+///
+/// Usage example:
+/// \code
+/// sf::DrawQueue queue;
+/// for (std::size_t i = 0; i < tiles.size(); ++i)
+///     queue.add(tiles[i], 0, sf::RenderStates::Default, sf::DrawQueue::Unordered);
+/// for (std::size_t i = 0; i < characters.size(); ++i)
+///     queue.add(characters[i], 1);
+/// queue.add(hud, 2);
+///
+/// window.draw(queue);
+/// \endcode
+///
+/// \see sf::CommandList, sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
@@ -301,6 +301,37 @@ public:
     ////////////////////////////////////////////////////////////
     bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable premultiplied alpha glyph pages
+    ///
+    /// When enabled, the glyphs are rendered into their page
+    /// textures with premultiplied alpha, and sf::Text draws
+    /// them with sf::BlendPremultipliedAlpha instead of
+    /// sf::BlendAlpha. This avoids the fringes that straight
+    /// alpha produces when text is drawn into a transparent
+    /// sf::RenderTexture that is later composited.
+    ///
+    /// Changing this setting clears the glyph cache; texts that
+    /// use the font rebuild their geometry automatically.
+    /// Premultiplied alpha is disabled by default.
+    ///
+    /// \param premultiplied True to enable premultiplied alpha, false to disable it
+    ///
+    /// \see isPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPremultipliedAlpha(bool premultiplied);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the glyph pages use premultiplied alpha
+    ///
+    /// \return True if premultiplied alpha is enabled, false if it is disabled
+    ///
+    /// \see setPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isPremultipliedAlpha() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -351,6 +382,16 @@ private:
     ////////////////////////////////////////////////////////////
     void cleanup();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Find or create the page of glyphs of a character size
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return The page corresponding to \a characterSize
+    ///
+    ////////////////////////////////////////////////////////////
+    Page& loadPage(unsigned int characterSize) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Load a new glyph and store it in the cache
     ///
@@ -394,15 +435,16 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    void*                      m_library;     //!< Pointer to the internal library interface (it is typeless to avoid exposing implementation details)
-    void*                      m_face;        //!< Pointer to the internal font face (it is typeless to avoid exposing implementation details)
-    void*                      m_streamRec;   //!< Pointer to the stream rec instance (it is typeless to avoid exposing implementation details)
-    void*                      m_stroker;     //!< Pointer to the stroker (it is typeless to avoid exposing implementation details)
-    int*                       m_refCount;    //!< Reference counter used by implicit sharing
-    bool                       m_isSmooth;    //!< Status of the smooth filter
-    Info                       m_info;        //!< Information about the font
-    mutable PageTable          m_pages;       //!< Table containing the glyphs pages by character size
-    mutable std::vector<Uint8> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
+    void*                      m_library;            //!< Pointer to the internal library interface (it is typeless to avoid exposing implementation details)
+    void*                      m_face;               //!< Pointer to the internal font face (it is typeless to avoid exposing implementation details)
+    void*                      m_streamRec;          //!< Pointer to the stream rec instance (it is typeless to avoid exposing implementation details)
+    void*                      m_stroker;            //!< Pointer to the stroker (it is typeless to avoid exposing implementation details)
+    int*                       m_refCount;           //!< Reference counter used by implicit sharing
+    bool                       m_isSmooth;           //!< Status of the smooth filter
+    bool                       m_premultipliedAlpha; //!< Are the glyph pages stored with premultiplied alpha?
+    Info                       m_info;               //!< Information about the font
+    mutable PageTable          m_pages;              //!< Table containing the glyphs pages by character size
+    mutable std::vector<Uint8> m_pixelBuffer;        //!< Pixel buffer holding a glyph's pixels before being written to the texture
     #ifdef SFML_SYSTEM_ANDROID
     void*                      m_stream; //!< Asset file streamer (if loaded from file)
     #endif
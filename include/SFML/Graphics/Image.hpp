@@ -176,6 +176,20 @@ public:
     ////////////////////////////////////////////////////////////
     void createMaskFromColor(const Color& color, Uint8 alpha = 0);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert the pixels from straight to premultiplied alpha
+    ///
+    /// This function multiplies the red, green and blue
+    /// components of every pixel by its alpha component, so that
+    /// the image can be drawn with sf::BlendPremultipliedAlpha.
+    /// The conversion is lossy for translucent pixels, and must
+    /// only be applied once.
+    ///
+    /// \see sf::Texture::setPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    void premultiplyAlpha();
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy pixels from another image onto this one
     ///
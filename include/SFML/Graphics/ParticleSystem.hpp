@@ -0,0 +1,386 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PARTICLESYSTEM_HPP
+#define SFML_PARTICLESYSTEM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/System/Time.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable set of short-lived particles, simulated
+///        on the CPU and streamed to the GPU every frame
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ParticleSystem : public Drawable, public Transformable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Ways of rendering the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    enum RenderMode
+    {
+        PointSprites,  //!< One point of the particle size per particle
+        TexturedQuads  //!< One textured square of the particle size per particle
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty particle system rendered as points.
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy Instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem(const ParticleSystem& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ParticleSystem();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem& operator =(const ParticleSystem& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Emit a new particle
+    ///
+    /// \param position Initial position of the particle, in local coordinates
+    /// \param velocity Initial velocity of the particle, in units per second
+    /// \param color    Color of the particle
+    /// \param lifetime Time before the particle dies
+    ///
+    ////////////////////////////////////////////////////////////
+    void emit(const Vector2f& position, const Vector2f& velocity, const Color& color, Time lifetime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Advance the simulation
+    ///
+    /// Moves every particle according to its velocity and to
+    /// the acceleration of the system, and removes the ones
+    /// whose lifetime is over.
+    ///
+    /// \param elapsed Time elapsed since the last update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Time elapsed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for a given number of particles
+    ///
+    /// \param count Number of particles to reserve memory for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of living particles
+    ///
+    /// \return Number of particles
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getParticleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a particle
+    ///
+    /// Particles are kept in the order they were emitted.
+    ///
+    /// \param index Index of the particle, in range [0, getParticleCount() - 1]
+    ///
+    /// \return Position of the particle, in local coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2f getParticlePosition(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the remaining lifetime of a particle
+    ///
+    /// \param index Index of the particle, in range [0, getParticleCount() - 1]
+    ///
+    /// \return Time before the particle dies
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getParticleLifetime(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the acceleration applied to every particle
+    ///
+    /// This is typically used for gravity or wind.
+    /// The default acceleration is (0, 0).
+    ///
+    /// \param acceleration Acceleration, in units per second squared
+    ///
+    /// \see getAcceleration
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAcceleration(const Vector2f& acceleration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the acceleration applied to every particle
+    ///
+    /// \return Acceleration, in units per second squared
+    ///
+    /// \see setAcceleration
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2f& getAcceleration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the particles
+    ///
+    /// In TexturedQuads mode, the size is the side of the quad
+    /// in local coordinates. In PointSprites mode, it is passed
+    /// to glPointSize and is therefore expressed in pixels of
+    /// the render target, regardless of the view and transform.
+    /// The default size is 1.
+    ///
+    /// \param size New size of the particles
+    ///
+    /// \see getParticleSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setParticleSize(float size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the particles
+    ///
+    /// \return Size of the particles
+    ///
+    /// \see setParticleSize
+    ///
+    ////////////////////////////////////////////////////////////
+    float getParticleSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the way the particles are rendered
+    ///
+    /// The default mode is PointSprites.
+    ///
+    /// \param mode New render mode
+    ///
+    /// \see getRenderMode
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRenderMode(RenderMode mode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the way the particles are rendered
+    ///
+    /// \return Current render mode
+    ///
+    /// \see setRenderMode
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderMode getRenderMode() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texture applied to the particles
+    ///
+    /// The whole texture is mapped on every particle. In
+    /// PointSprites mode, the texture is only applied if the
+    /// GL_ARB_point_sprite extension is available and the
+    /// render target uses the fixed-function pipeline.
+    /// The \a texture argument refers to a texture that must
+    /// exist as long as the particle system uses it.
+    ///
+    /// \param texture New texture, or NULL to disable texturing
+    ///
+    /// \see getTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture* texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture applied to the particles
+    ///
+    /// \return Pointer to the texture, or NULL if there's none
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable fading out of the particles
+    ///
+    /// When enabled, the alpha of each particle decreases
+    /// linearly with its remaining lifetime.
+    /// Fading out is disabled by default.
+    ///
+    /// \param fadeOut True to fade particles out
+    ///
+    /// \see isFadingOut
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFadeOut(bool fadeOut);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether particles fade out
+    ///
+    /// \return True if particles fade out
+    ///
+    /// \see setFadeOut
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isFadingOut() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the particle system to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rebuild the vertices of the particles, and upload
+    ///        them to the vertex buffer if possible
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateVertices() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<float>          m_positionsX;   //!< X coordinate of the position of each particle
+    std::vector<float>          m_positionsY;   //!< Y coordinate of the position of each particle
+    std::vector<float>          m_velocitiesX;  //!< X component of the velocity of each particle
+    std::vector<float>          m_velocitiesY;  //!< Y component of the velocity of each particle
+    std::vector<float>          m_remaining;    //!< Remaining lifetime of each particle, in seconds
+    std::vector<float>          m_lifetimes;    //!< Total lifetime of each particle, in seconds
+    std::vector<Color>          m_colors;       //!< Color of each particle
+    Vector2f                    m_acceleration; //!< Acceleration applied to all the particles
+    float                       m_particleSize; //!< Size of the particles
+    RenderMode                  m_renderMode;   //!< Way of rendering the particles
+    const Texture*              m_texture;      //!< Texture applied to the particles
+    bool                        m_fadeOut;      //!< Do the particles fade out?
+    mutable std::vector<Vertex> m_vertices;     //!< Staging vertices, rebuilt when the particles change
+    mutable VertexBuffer*       m_buffer;       //!< Streaming vertex buffer the vertices are uploaded to, created on the first draw
+    mutable bool                m_needUpdate;   //!< Do the vertices need to be rebuilt?
+};
+
+} // namespace sf
+
+
+#endif // SFML_PARTICLESYSTEM_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ParticleSystem
+/// \ingroup graphics
+///
+/// sf::ParticleSystem manages a large number of simple
+/// particles: each one has a position, a velocity, a color
+/// and a lifetime. Particles are created with emit, moved
+/// and aged with update, and automatically removed when
+/// their lifetime is over.
+///
+/// The particles are stored as a structure of arrays (one
+/// array per attribute) rather than as an array of
+/// structures, so that the update loops run over contiguous
+/// floats and can be vectorized by the compiler. When the
+/// system is drawn after it changed, the vertices of all the
+/// particles are rebuilt and uploaded at once to a
+/// sf::VertexBuffer created with the sf::VertexBuffer::Stream
+/// usage; the whole system is then rendered with a single
+/// draw call. If vertex buffers are not available, the
+/// vertices are drawn directly from memory.
+///
+/// In PointSprites mode, each particle is a single vertex
+/// drawn as a sf::Points primitive whose size is set with
+/// glPointSize. This is the cheapest mode, but the size of
+/// the points is in pixels and the texture, if any, is only
+/// applied if point sprites are supported, which excludes
+/// core profile contexts. Since the point size is part of
+/// the OpenGL state, it is only applied when the system is
+/// drawn to a target that owns an OpenGL context (not to a
+/// sf::CommandList).
+/// In TexturedQuads mode, each particle is a square made of
+/// two triangles, which is scaled by the view and transform
+/// like any other entity.
+///
+/// Usage example:
+/// \code
+/// sf::ParticleSystem particles;
+/// particles.setAcceleration(sf::Vector2f(0.f, 200.f));
+/// particles.setParticleSize(3.f);
+/// particles.setFadeOut(true);
+///
+/// while (window.isOpen())
+/// {
+///     for (int i = 0; i < 1000; ++i)
+///         particles.emit(emitterPosition, randomVelocity(), sf::Color::Yellow, sf::seconds(2.f));
+///
+///     particles.update(clock.restart());
+///
+///     window.clear();
+///     window.draw(particles);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::VertexArray
+///
+////////////////////////////////////////////////////////////
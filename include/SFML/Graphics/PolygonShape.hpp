@@ -0,0 +1,391 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_POLYGONSHAPE_HPP
+#define SFML_POLYGONSHAPE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Filled polygon that may be concave and have holes
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API PolygonShape : public Drawable, public Transformable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// \param pointCount Number of points of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit PolygonShape(std::size_t pointCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy Instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    PolygonShape(const PolygonShape& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~PolygonShape();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    PolygonShape& operator =(const PolygonShape& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of points of the polygon
+    ///
+    /// \a count must be greater than 2 to define a valid shape.
+    ///
+    /// \param count New number of points of the polygon
+    ///
+    /// \see getPointCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPointCount(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of points of the polygon
+    ///
+    /// \return Number of points of the polygon
+    ///
+    /// \see setPointCount
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPointCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a point of the outer boundary
+    ///
+    /// The points must be ordered along the boundary of the
+    /// polygon, in either direction, and the boundary must not
+    /// intersect itself.
+    /// setPointCount must be called first in order to set the total
+    /// number of points. The result is undefined if \a index is out
+    /// of the valid range.
+    ///
+    /// \param index Index of the point to change, in range [0 .. getPointCount() - 1]
+    /// \param point New position of the point
+    ///
+    /// \see getPoint
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPoint(std::size_t index, const Vector2f& point);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a point of the outer boundary
+    ///
+    /// The returned point is in local coordinates, that is,
+    /// the shape's transforms (position, rotation, scale) are
+    /// not taken into account.
+    /// The result is undefined if \a index is out of the valid range.
+    ///
+    /// \param index Index of the point to get, in range [0 .. getPointCount() - 1]
+    ///
+    /// \return Position of the index-th point of the polygon
+    ///
+    /// \see setPoint
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2f getPoint(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a hole to the polygon
+    ///
+    /// The hole is defined by the ordered points of its boundary,
+    /// in either direction. It must lie entirely inside the
+    /// polygon, and must not intersect the other holes.
+    ///
+    /// \param points Pointer to the points of the hole
+    /// \param count  Number of points, must be greater than 2
+    ///
+    /// \see clearHoles, getHoleCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void addHole(const Vector2f* points, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the holes of the polygon
+    ///
+    /// \see addHole
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearHoles();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of holes of the polygon
+    ///
+    /// \return Number of holes
+    ///
+    /// \see addHole
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getHoleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of the polygon
+    ///
+    /// The \a texture argument refers to a texture that must
+    /// exist as long as the polygon uses it. If \a resetRect is
+    /// true, the texture rect of the polygon is automatically
+    /// adjusted to the size of the new texture. If it is false,
+    /// the texture rect is left unchanged.
+    ///
+    /// \param texture   New texture
+    /// \param resetRect Should the texture rect be reset to the size of the new texture?
+    ///
+    /// \see getTexture, setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture* texture, bool resetRect = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of the polygon
+    ///
+    /// \return Pointer to the polygon's texture
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture that the polygon will display
+    ///
+    /// The texture rect is mapped on the bounding rectangle of
+    /// the polygon. By default, the texture rect covers the
+    /// entire texture.
+    ///
+    /// \param rect Rectangle defining the region of the texture to display
+    ///
+    /// \see getTextureRect, setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(const IntRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture displayed by the polygon
+    ///
+    /// \return Texture rectangle of the polygon
+    ///
+    /// \see setTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    const IntRect& getTextureRect() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the fill color of the polygon
+    ///
+    /// By default, the polygon's fill color is opaque white.
+    ///
+    /// \param color New color of the polygon
+    ///
+    /// \see getFillColor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFillColor(const Color& color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the fill color of the polygon
+    ///
+    /// \return Fill color of the polygon
+    ///
+    /// \see setFillColor
+    ///
+    ////////////////////////////////////////////////////////////
+    const Color& getFillColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of triangles the polygon is split into
+    ///
+    /// This function triangulates the polygon if its points or
+    /// holes changed since the last triangulation.
+    ///
+    /// \return Number of triangles
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getTriangleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a point of the triangles the polygon is split into
+    ///
+    /// The triangles are stored one after the other, three
+    /// points each. This function triangulates the polygon if
+    /// its points or holes changed since the last triangulation.
+    ///
+    /// \param index Index of the point, in range [0 .. getTriangleCount() * 3 - 1]
+    ///
+    /// \return Position of the point, in local coordinates
+    ///
+    /// \see getTriangleCount
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2f getTrianglePoint(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the polygon
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    ///
+    /// \return Local bounding rectangle of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global (non-minimal) bounding rectangle of the polygon
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    ///
+    /// \return Global bounding rectangle of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the polygon to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Triangulate the polygon if its points or holes changed
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureTriangulation() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the color and texture coordinates of the vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateVertices() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vector2f>               m_points;            //!< Points of the outer boundary
+    std::vector<std::vector<Vector2f> > m_holes;             //!< Points of the boundary of each hole
+    const Texture*                      m_texture;           //!< Texture of the polygon
+    IntRect                             m_textureRect;       //!< Rectangle defining the area of the source texture to display
+    Color                               m_fillColor;         //!< Fill color
+    mutable std::vector<Vertex>         m_vertices;          //!< Triangles of the polygon
+    mutable VertexBuffer*               m_buffer;            //!< Vertex buffer the triangles are uploaded to, created on the first upload
+    mutable FloatRect                   m_bounds;            //!< Bounding rectangle of the polygon
+    mutable bool                        m_needTriangulation; //!< Do the points need to be triangulated again?
+    mutable bool                        m_needUpload;        //!< Do the vertices need to be updated and uploaded again?
+};
+
+} // namespace sf
+
+
+#endif // SFML_POLYGONSHAPE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PolygonShape
+/// \ingroup graphics
+///
+/// sf::PolygonShape is a filled polygon that, unlike
+/// sf::ConvexShape, can be concave and can have holes.
+///
+/// The polygon is triangulated by ear clipping: holes are
+/// first connected to the outer boundary by bridges, which
+/// turns the polygon into a single simple boundary, and
+/// triangles are then cut off that boundary one at a time.
+/// The triangulation is only computed again when the points
+/// or the holes change, and the resulting triangles are
+/// stored in a static sf::VertexBuffer when vertex buffers
+/// are available. Drawing the polygon therefore costs a
+/// single draw call, with no work on the CPU, which makes it
+/// well suited to static vector art such as map regions.
+/// Changing the fill color or the texture rectangle updates
+/// the vertices without triangulating the polygon again.
+///
+/// The boundaries must be simple (not self-intersecting),
+/// and holes must be inside the outer boundary without
+/// touching each other. The polygon has no outline; it can be
+/// combined with a sf::ConvexShape or sf::VertexArray of
+/// lines if one is needed.
+///
+/// Usage example:
+/// \code
+/// // An L-shaped region with a square hole
+/// sf::PolygonShape region(6);
+/// region.setPoint(0, sf::Vector2f(0, 0));
+/// region.setPoint(1, sf::Vector2f(100, 0));
+/// region.setPoint(2, sf::Vector2f(100, 40));
+/// region.setPoint(3, sf::Vector2f(40, 40));
+/// region.setPoint(4, sf::Vector2f(40, 100));
+/// region.setPoint(5, sf::Vector2f(0, 100));
+///
+/// sf::Vector2f hole[] = {sf::Vector2f(10, 10), sf::Vector2f(30, 10), sf::Vector2f(30, 30), sf::Vector2f(10, 30)};
+/// region.addHole(hole, 4);
+///
+/// region.setFillColor(sf::Color::Green);
+/// ...
+/// window.draw(region);
+/// \endcode
+///
+/// \see sf::ConvexShape, sf::VertexBuffer
+///
+////////////////////////////////////////////////////////////
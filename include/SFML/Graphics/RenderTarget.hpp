@@ -39,13 +39,20 @@
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
+#include <vector>
 
 
 namespace sf
 {
+class CommandList;
 class Drawable;
 class VertexBuffer;
 
+namespace priv
+{
+    class CoreProfileRenderer;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Base class for all render targets (window, texture, ...)
 ///
@@ -307,6 +314,102 @@ public:
     ////////////////////////////////////////////////////////////
     void draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Replay the commands recorded in a command list
+    ///
+    /// The commands are executed in the order they were
+    /// recorded. If the list changed the view, the view of
+    /// the target is restored once all the commands have
+    /// been executed.
+    ///
+    /// This function must be called from the thread that
+    /// renders to the target, and the list must not be
+    /// modified by another thread while it is submitted.
+    ///
+    /// \param commandList Command list to replay
+    ///
+    /// \see sf::CommandList
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit(const CommandList& commandList);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable partial redraw
+    ///
+    /// In partial redraw mode, the target keeps track of a
+    /// damaged area, and clears and draws are restricted to it
+    /// with the scissor test: draws that lie entirely outside
+    /// of it are skipped, and the pixels outside of it keep
+    /// the content of the previous frame. The damaged area is
+    /// extended by invalidate and by submitting command lists,
+    /// and it is reset every time the target is displayed.
+    ///
+    /// A command list damages the target only with the commands
+    /// that differ from the list submitted at the same position
+    /// in the previous frame: the first list submitted in a frame
+    /// is compared to the first one of the previous frame, the
+    /// second to the second, and so on.
+    ///
+    /// Enabling partial redraw invalidates the whole target,
+    /// so that the first frame is drawn completely.
+    ///
+    /// Partial redraw is disabled by default.
+    ///
+    /// \param enabled True to enable partial redraw, false to disable it
+    ///
+    /// \see isPartialRedrawEnabled, invalidate, getDamagedArea
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPartialRedrawEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether partial redraw is enabled
+    ///
+    /// \return True if partial redraw is enabled, false if it is disabled
+    ///
+    /// \see setPartialRedrawEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isPartialRedrawEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the whole target as damaged
+    ///
+    /// This function has no effect if partial redraw is disabled.
+    ///
+    /// \see setPartialRedrawEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark an area of the target as damaged
+    ///
+    /// The area is given in the coordinates of the current view,
+    /// the same ones as the bounds of the entities drawn with it.
+    /// It must cover everything that changed on the target since
+    /// the last time it was displayed: typically the previous
+    /// and the new bounds of an entity that moved.
+    ///
+    /// This function has no effect if partial redraw is disabled.
+    ///
+    /// \param area Area to redraw, in current view coordinates
+    ///
+    /// \see setPartialRedrawEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate(const FloatRect& area);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area that has to be redrawn in the current frame
+    ///
+    /// \return Damaged area in pixels (top-left origin), empty if nothing is damaged
+    ///
+    /// \see setPartialRedrawEnabled, invalidate
+    ///
+    ////////////////////////////////////////////////////////////
+    const IntRect& getDamagedArea() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -366,6 +469,10 @@ public:
     /// saved and restored). Take a look at the resetGLStates
     /// function if you do so.
     ///
+    /// Core profile contexts have no OpenGL state stacks: with
+    /// them, pushGLStates only sets up SFML's states, like
+    /// resetGLStates, and popGLStates does nothing.
+    ///
     /// \see popGLStates
     ///
     ////////////////////////////////////////////////////////////
@@ -422,8 +529,38 @@ protected:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the damaged area once a frame has been presented
+    ///
+    /// This also starts a new sequence of submitted command lists,
+    /// which are compared to the ones of the frame just presented.
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetDamage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the damaged area of the target into a texture
+    ///
+    /// The pixels are copied at the same position in the
+    /// texture, which must have the size of the target.
+    ///
+    /// \param frame Texture keeping a copy of the last frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void saveFrame(Texture& frame);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a copy of a frame over the whole target
+    ///
+    /// \param frame Texture keeping a copy of the last frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void restoreFrame(const Texture& frame);
+
 private:
 
+    friend class CommandList;
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply the current view
     ///
@@ -497,6 +634,60 @@ private:
     ////////////////////////////////////////////////////////////
     void cleanupDraw(const RenderStates& states);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Select the rendering backend for the active context
+    ///
+    /// The backend is selected the first time the target sets
+    /// its OpenGL states: core profile contexts are drawn with
+    /// a shader-based backend, other contexts with the
+    /// fixed-function pipeline.
+    ///
+    /// \return True if the core profile backend is used
+    ///
+    ////////////////////////////////////////////////////////////
+    bool selectBackend();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the pixels covered by an area through a view
+    ///
+    /// \param area Area in world coordinates
+    /// \param view View to map the area with
+    ///
+    /// \return Pixels covered by the area, clipped to the viewport
+    ///
+    ////////////////////////////////////////////////////////////
+    IntRect mapRectToPixels(const FloatRect& area, const View& view) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extend the damaged area
+    ///
+    /// \param area Damaged pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void addDamage(const IntRect& area);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extend the damaged area with the differences between
+    ///        a command list and the one submitted at the same
+    ///        position in the previous frame
+    ///
+    /// \param commandList Command list about to be submitted
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateDamage(const CommandList& commandList);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Signature of a command submitted in partial redraw mode
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CommandSignature
+    {
+        Uint64  hash;   //!< Hash of everything that affects the output of the command
+        IntRect bounds; //!< Pixels that the command may touch
+    };
+
+    typedef std::vector<CommandSignature> Signatures;
+
     ////////////////////////////////////////////////////////////
     /// \brief Render states cache
     ///
@@ -521,10 +712,17 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View        m_defaultView; //!< Default view
-    View        m_view;        //!< Current view
-    StatesCache m_cache;       //!< Render states cache
-    Uint64      m_id;          //!< Unique number that identifies the RenderTarget
+    View                          m_defaultView;     //!< Default view
+    View                          m_view;            //!< Current view
+    StatesCache                   m_cache;           //!< Render states cache
+    Uint64                        m_id;              //!< Unique number that identifies the RenderTarget
+    CommandList*                  m_commandList;     //!< Command list recording the draws, if this target is one
+    priv::CoreProfileRenderer*    m_coreRenderer;    //!< Backend used with core profile contexts, NULL with the fixed-function pipeline
+    bool                          m_backendSelected; //!< Has the backend been selected for the current context?
+    bool                          m_partialRedraw;   //!< Are clears and draws restricted to the damaged area?
+    IntRect                       m_damage;          //!< Area to redraw in the current frame, in pixels
+    std::vector<Signatures>       m_signatures;      //!< Signatures of the command lists submitted in the previous frame, by submission order
+    std::size_t                   m_submitCount;     //!< Number of command lists submitted in the current frame
 };
 
 } // namespace sf
@@ -555,6 +753,13 @@ private:
 /// OpenGL states are not messed up by calling the
 /// pushGLStates/popGLStates functions.
 ///
+/// Render targets work with both compatibility and core
+/// profile contexts (see sf::ContextSettings::Core). With a
+/// core profile, which has no fixed-function pipeline, the
+/// vertices are streamed into a vertex buffer and drawn with
+/// a built-in shader; custom sf::Shader objects are not
+/// supported in this mode.
+///
 /// \see sf::RenderWindow, sf::RenderTexture, sf::View
 ///
 ////////////////////////////////////////////////////////////
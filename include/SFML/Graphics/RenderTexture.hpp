@@ -206,6 +206,63 @@ public:
     ////////////////////////////////////////////////////////////
     void display();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the automatic resolve in display()
+    ///
+    /// When the render-texture is multisampled, display() copies
+    /// ("resolves") the multisample buffer into the target texture,
+    /// which is an expensive operation on large targets. If the
+    /// texture is not sampled every frame, or only a part of it
+    /// changed, automatic resolve can be disabled and resolve()
+    /// called explicitly before the texture is used.
+    ///
+    /// Automatic resolve is enabled by default. This setting has
+    /// no effect on render-textures that are not multisampled.
+    ///
+    /// \param enabled True to resolve in display(), false to only resolve in resolve()
+    ///
+    /// \see isAutoResolveEnabled, resolve
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAutoResolveEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether display() resolves the multisample buffer
+    ///
+    /// \return True if automatic resolve is enabled, false if it is disabled
+    ///
+    /// \see setAutoResolveEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isAutoResolveEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resolve the whole multisample buffer into the target texture
+    ///
+    /// This function is only needed when automatic resolve is
+    /// disabled; it has the same effect as display() with
+    /// automatic resolve enabled.
+    ///
+    /// \see setAutoResolveEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void resolve();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resolve a region of the multisample buffer into the target texture
+    ///
+    /// Only the pixels inside \a area are updated in the target
+    /// texture, which is cheaper than a full resolve when only a
+    /// small part of the render-texture has been redrawn. The
+    /// area is clamped to the size of the render-texture.
+    ///
+    /// \param area Region to resolve, in pixels (top-left origin)
+    ///
+    /// \see setAutoResolveEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void resolve(const IntRect& area);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the texture
     ///
@@ -238,8 +295,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    priv::RenderTextureImpl* m_impl;    //!< Platform/hardware specific implementation
-    Texture                  m_texture; //!< Target texture to draw on
+    priv::RenderTextureImpl* m_impl;        //!< Platform/hardware specific implementation
+    Texture                  m_texture;     //!< Target texture to draw on
+    bool                     m_autoResolve; //!< Resolve the multisample buffer in display()?
 };
 
 } // namespace sf
@@ -31,6 +31,7 @@
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
 #include <SFML/Window/Window.hpp>
 #include <string>
 
@@ -178,12 +179,41 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual void onResize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the back buffer is displayed
+    ///
+    /// In partial redraw mode, the frame is copied into an
+    /// offscreen texture, since the back buffer is undefined
+    /// after it is displayed. If nothing was damaged, the frame
+    /// on screen is still up to date and the back buffer is
+    /// untouched, so nothing is displayed.
+    ///
+    /// \return True to display the back buffer, false to keep the current frame on screen
+    ///
+    /// \see setPartialRedrawEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool onPreDisplay();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called after the back buffer has been displayed
+    ///
+    /// In partial redraw mode, the copy of the previous frame is
+    /// drawn to the new back buffer, so that the next frame only
+    /// has to redraw what changed.
+    ///
+    /// \see setPartialRedrawEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onPostDisplay();
+
 private:
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     unsigned int m_defaultFrameBuffer; //!< Framebuffer to bind when targeting this window
+    Texture      m_frame;              //!< Copy of the last displayed frame, in partial redraw mode
 };
 
 } // namespace sf
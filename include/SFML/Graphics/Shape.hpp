@@ -45,6 +45,17 @@ class SFML_GRAPHICS_API Shape : public Drawable, public Transformable
 {
 public:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Ways of joining the outline at the corners of the shape
+    ///
+    ////////////////////////////////////////////////////////////
+    enum OutlineJoin
+    {
+        MiterJoin, //!< Sharp corners, beveled when longer than the miter limit
+        BevelJoin, //!< Corners cut by a straight line
+        RoundJoin  //!< Corners rounded by an arc
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Virtual destructor
     ///
@@ -131,6 +142,56 @@ public:
     ////////////////////////////////////////////////////////////
     void setOutlineThickness(float thickness);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the way the outline is joined at the corners
+    ///
+    /// The join is applied to the corners around which the
+    /// outline turns outwards; on the other side, consecutive
+    /// edges of the outline always meet at a single point.
+    /// By default, the outline join is sf::Shape::MiterJoin.
+    ///
+    /// \param join New outline join
+    ///
+    /// \see getOutlineJoin, setMiterLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutlineJoin(OutlineJoin join);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the miter limit of the outline
+    ///
+    /// When the outline join is sf::Shape::MiterJoin, corners
+    /// whose miter would extend further than \a limit times the
+    /// outline thickness from the point of the shape are beveled
+    /// instead, so that sharp corners don't produce long spikes.
+    /// By default, the miter limit is 4.
+    ///
+    /// \param limit New miter limit, relative to the outline thickness
+    ///
+    /// \see getMiterLimit, setOutlineJoin
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMiterLimit(float limit);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the width of the anti-aliasing fringe of the shape
+    ///
+    /// When the width is positive, a thin band whose alpha fades
+    /// from the color of the edge to fully transparent is added
+    /// around the outer edge of the shape (the outline if there's
+    /// one, the fill otherwise). With a width of about one pixel,
+    /// this smooths the edges of the shape without requiring
+    /// multisampling. The fringe is never textured, and it is
+    /// included in the bounds of the shape.
+    /// By default, the fringe width is 0 (no fringe).
+    ///
+    /// \param width Width of the fringe, in local coordinates
+    ///
+    /// \see getEdgeFringe
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEdgeFringe(float width);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the source texture of the shape
     ///
@@ -185,6 +246,36 @@ public:
     ////////////////////////////////////////////////////////////
     float getOutlineThickness() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the way the outline is joined at the corners
+    ///
+    /// \return Outline join of the shape
+    ///
+    /// \see setOutlineJoin
+    ///
+    ////////////////////////////////////////////////////////////
+    OutlineJoin getOutlineJoin() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the miter limit of the outline
+    ///
+    /// \return Miter limit, relative to the outline thickness
+    ///
+    /// \see setMiterLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    float getMiterLimit() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the width of the anti-aliasing fringe of the shape
+    ///
+    /// \return Width of the fringe, in local coordinates
+    ///
+    /// \see setEdgeFringe
+    ///
+    ////////////////////////////////////////////////////////////
+    float getEdgeFringe() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the total number of points of the shape
     ///
@@ -262,6 +353,10 @@ protected:
     /// the shape's points change (i.e. the result of either
     /// getPointCount or getPoint is different).
     ///
+    /// The geometry is not recomputed immediately: it is only
+    /// marked as outdated, and rebuilt the next time the shape
+    /// is drawn or its bounds are requested.
+    ///
     ////////////////////////////////////////////////////////////
     void update();
 
@@ -276,44 +371,74 @@ private:
     ////////////////////////////////////////////////////////////
     virtual void draw(RenderTarget& target, RenderStates states) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Parts of the geometry that need to be recomputed
+    ///
+    ////////////////////////////////////////////////////////////
+    enum DirtyFlags
+    {
+        PointsDirty        = 1 << 0, //!< The points of the shape changed
+        FillColorsDirty    = 1 << 1, //!< The fill color changed
+        TexCoordsDirty     = 1 << 2, //!< The texture rectangle changed
+        OutlineDirty       = 1 << 3, //!< The outline thickness changed
+        OutlineColorsDirty = 1 << 4  //!< The outline color changed
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the outdated parts of the geometry
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureGeometryUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the fill vertices' position
+    ///
+    ////////////////////////////////////////////////////////////
+    void updatePoints() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateFillColors();
+    void updateFillColors() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' texture coordinates
     ///
     ////////////////////////////////////////////////////////////
-    void updateTexCoords();
+    void updateTexCoords() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' position
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutline();
+    void updateOutline() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutlineColors();
+    void updateOutlineColors() const;
 
 private:
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const Texture* m_texture;          //!< Texture of the shape
-    IntRect        m_textureRect;      //!< Rectangle defining the area of the source texture to display
-    Color          m_fillColor;        //!< Fill color
-    Color          m_outlineColor;     //!< Outline color
-    float          m_outlineThickness; //!< Thickness of the shape's outline
-    VertexArray    m_vertices;         //!< Vertex array containing the fill geometry
-    VertexArray    m_outlineVertices;  //!< Vertex array containing the outline geometry
-    FloatRect      m_insideBounds;     //!< Bounding rectangle of the inside (fill)
-    FloatRect      m_bounds;           //!< Bounding rectangle of the whole shape (outline + fill)
+    const Texture*       m_texture;          //!< Texture of the shape
+    IntRect              m_textureRect;      //!< Rectangle defining the area of the source texture to display
+    Color                m_fillColor;        //!< Fill color
+    Color                m_outlineColor;     //!< Outline color
+    float                m_outlineThickness; //!< Thickness of the shape's outline
+    OutlineJoin          m_outlineJoin;      //!< Way of joining the outline at the corners
+    float                m_miterLimit;       //!< Maximum length of outline miters, relative to the thickness
+    float                m_edgeFringe;       //!< Width of the anti-aliasing fringe
+    mutable VertexArray  m_vertices;         //!< Vertex array containing the fill geometry
+    mutable VertexArray  m_outlineVertices;  //!< Vertex array containing the outline geometry
+    mutable FloatRect    m_insideBounds;     //!< Bounding rectangle of the inside (fill)
+    mutable FloatRect    m_bounds;           //!< Bounding rectangle of the whole shape (outline + fill)
+    mutable std::size_t  m_fringeStart;      //!< Index of the first vertex of the fringe in the outline vertices
+    mutable unsigned int m_dirtyFlags;       //!< Combination of DirtyFlags for the parts of the geometry to recompute
 };
 
 } // namespace sf
@@ -339,11 +464,19 @@ private:
 /// \li a fill color
 /// \li an outline color
 /// \li an outline thickness
+/// \li an outline join and miter limit
+/// \li an anti-aliasing fringe width
 ///
 /// Each feature is optional, and can be disabled easily:
 /// \li the texture can be null
 /// \li the fill/outline colors can be sf::Color::Transparent
 /// \li the outline thickness can be zero
+/// \li the fringe width can be zero
+///
+/// The geometry of the shape is cached: it is only computed
+/// again when the points, the outline thickness, the outline
+/// join or the fringe width change. Changing colors or the
+/// texture rectangle only updates the existing vertices.
 ///
 /// You can write your own derived shape class, there are only
 /// two virtual functions to override:
@@ -0,0 +1,294 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SPATIALINDEX_HPP
+#define SFML_SPATIALINDEX_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Config.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <map>
+#include <vector>
+
+
+namespace sf
+{
+class Drawable;
+class RenderTarget;
+class View;
+
+////////////////////////////////////////////////////////////
+/// \brief Spatial index of axis-aligned bounding boxes, used
+///        to find and draw the objects visible in a view
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpatialIndex
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty index with cells of 256x256 units.
+    ///
+    ////////////////////////////////////////////////////////////
+    SpatialIndex();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty index with a given cell size
+    ///
+    /// The cell size should be close to the size of the
+    /// typical object stored in the index. Objects larger
+    /// than a cell are still supported, but they are tested
+    /// on every query.
+    ///
+    /// \param cellSize Size of the cells of the index, in world units
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpatialIndex(float cellSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Insert an object into the index
+    ///
+    /// The index doesn't own the drawable, it must stay alive
+    /// as long as it is stored in the index. Passing a null
+    /// drawable is allowed, the object can then only be
+    /// retrieved with query().
+    ///
+    /// \param bounds   Global bounding rectangle of the object
+    /// \param drawable Drawable associated to the object
+    ///
+    /// \return Identifier of the object in the index
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t insert(const FloatRect& bounds, const Drawable* drawable = NULL);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the bounds of an object
+    ///
+    /// This function must be called every time an object
+    /// moves or changes its size.
+    ///
+    /// \param id     Identifier of the object
+    /// \param bounds New global bounding rectangle of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(std::size_t id, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an object from the index
+    ///
+    /// The identifier of a removed object may be reused by
+    /// a subsequent call to insert().
+    ///
+    /// \param id Identifier of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(std::size_t id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the objects from the index
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of objects stored in the index
+    ///
+    /// \return Number of objects
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getObjectCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds of an object
+    ///
+    /// \param id Identifier of the object
+    ///
+    /// \return Global bounding rectangle of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    const FloatRect& getBounds(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the drawable associated to an object
+    ///
+    /// \param id Identifier of the object
+    ///
+    /// \return Drawable passed to insert(), can be null
+    ///
+    ////////////////////////////////////////////////////////////
+    const Drawable* getDrawable(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the objects that intersect an area
+    ///
+    /// The identifiers are appended to \a result in increasing
+    /// order, which is the insertion order as long as no
+    /// identifier has been reused.
+    ///
+    /// \param area   Area to test, in world units
+    /// \param result Vector to append the identifiers to
+    ///
+    /// \return Number of objects found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t query(const FloatRect& area, std::vector<std::size_t>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the objects visible in a view
+    ///
+    /// The area covered by the view is computed from its
+    /// center, size and rotation.
+    ///
+    /// \param view   View to test
+    /// \param result Vector to append the identifiers to
+    ///
+    /// \return Number of objects found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t query(const View& view, std::vector<std::size_t>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the objects visible in the current view of a target
+    ///
+    /// Objects are drawn in increasing identifier order.
+    /// If \a states has a transform, the bounds of the
+    /// objects are considered to be expressed before that
+    /// transform is applied.
+    ///
+    /// \param target Render target to draw to
+    /// \param states Render states to use for drawing
+    ///
+    /// \return Number of visible objects that were drawn
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t draw(RenderTarget& target, const RenderStates& states = RenderStates::Default) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area of the world covered by a view
+    ///
+    /// \param view View to compute the area of
+    ///
+    /// \return Axis-aligned bounding rectangle of the visible area, in world units
+    ///
+    ////////////////////////////////////////////////////////////
+    static FloatRect getViewBounds(const View& view);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Object stored in the index
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Object
+    {
+        FloatRect       bounds;   //!< Global bounding rectangle
+        const Drawable* drawable; //!< Associated drawable
+        Uint64          cell;     //!< Key of the cell containing the object
+        std::size_t     slot;     //!< Position of the object in its cell
+        bool            large;    //!< Is the object too large to be stored in a cell?
+        bool            used;     //!< Is this identifier in use?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Link an object to the cell that matches its bounds
+    ///
+    /// \param id Identifier of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    void link(std::size_t id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unlink an object from its cell
+    ///
+    /// \param id Identifier of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlink(std::size_t id);
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    typedef std::map<Uint64, std::vector<std::size_t> > CellMap;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    float                            m_cellSize; //!< Size of the cells, in world units
+    std::vector<Object>              m_objects;  //!< Objects, indexed by identifier
+    std::vector<std::size_t>         m_freeIds;  //!< Identifiers available for reuse
+    CellMap                          m_cells;    //!< Identifiers of the objects stored in each cell
+    std::vector<std::size_t>         m_large;    //!< Identifiers of the objects larger than a cell
+    std::size_t                      m_count;    //!< Number of objects in the index
+    mutable std::vector<std::size_t> m_visible;  //!< Identifiers of the visible objects, reused between draws
+};
+
+} // namespace sf
+
+
+#endif // SFML_SPATIALINDEX_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpatialIndex
+/// \ingroup graphics
+///
+/// sf::SpatialIndex stores the bounding rectangles of a large
+/// number of objects, and efficiently finds the ones that
+/// intersect a given area. Its main purpose is view culling:
+/// when most of a scene is off-screen, drawing only the
+/// objects that the index reports as visible avoids the cost
+/// of transforming and submitting all the others.
+///
+/// The index is a loose grid: each object is stored in the
+/// cell that contains the center of its bounding rectangle.
+/// Since objects may extend past their cell by up to half a
+/// cell, queries also look at the neighbouring cells. Objects
+/// larger than a cell are kept in a separate list that is
+/// tested on every query. Only the cells that contain objects
+/// use memory, so the world can be arbitrarily large.
+///
+/// Objects are identified by the integer returned by insert().
+/// Their bounds are not tracked automatically: when an object
+/// moves, its bounds must be updated with update().
+///
+/// Usage example:
+/// \code
+/// sf::SpatialIndex index(128.f);
+/// for (std::size_t i = 0; i < sprites.size(); ++i)
+///     index.insert(sprites[i].getGlobalBounds(), &sprites[i]);
+///
+/// // Draw only the sprites visible in the current view
+/// std::size_t visible = index.draw(window);
+/// \endcode
+///
+/// \see sf::View, sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
@@ -34,6 +34,7 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 #include <SFML/System/String.hpp>
 #include <string>
 #include <vector>
@@ -250,6 +251,29 @@ public:
     ////////////////////////////////////////////////////////////
     void setOutlineThickness(float thickness);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Freeze or unfreeze the text's geometry
+    ///
+    /// A frozen text stores its outline and fill geometry in a
+    /// single static vertex buffer, and is drawn with a single
+    /// draw call. Its geometry is only rebuilt when one of its
+    /// attributes changes or when the texture of the font page
+    /// it uses is resized or recreated; glyphs loaded into the
+    /// page by other texts don't affect it. This is meant for
+    /// labels that rarely or never change.
+    ///
+    /// If vertex buffers are not available on the system, a
+    /// frozen text is drawn like a regular one.
+    ///
+    /// By default, texts are not frozen.
+    ///
+    /// \param frozen True to freeze the text, false to unfreeze it
+    ///
+    /// \see isFrozen
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFrozen(bool frozen);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the text's string
     ///
@@ -367,6 +391,16 @@ public:
     ////////////////////////////////////////////////////////////
     float getOutlineThickness() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the text's geometry is frozen
+    ///
+    /// \return True if the text is frozen, false otherwise
+    ///
+    /// \see setFrozen
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isFrozen() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the position of the \a index-th character
     ///
@@ -432,23 +466,32 @@ private:
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the geometry of a frozen text to its vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateFrozenBuffer() const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    String              m_string;              //!< String to display
-    const Font*         m_font;                //!< Font used to display the string
-    unsigned int        m_characterSize;       //!< Base size of characters, in pixels
-    float               m_letterSpacingFactor; //!< Spacing factor between letters
-    float               m_lineSpacingFactor;   //!< Spacing factor between lines
-    Uint32              m_style;               //!< Text style (see Style enum)
-    Color               m_fillColor;           //!< Text fill color
-    Color               m_outlineColor;        //!< Text outline color
-    float               m_outlineThickness;    //!< Thickness of the text's outline
-    mutable VertexArray m_vertices;            //!< Vertex array containing the fill geometry
-    mutable VertexArray m_outlineVertices;     //!< Vertex array containing the outline geometry
-    mutable FloatRect   m_bounds;              //!< Bounding rectangle of the text (in local coordinates)
-    mutable bool        m_geometryNeedUpdate;  //!< Does the geometry need to be recomputed?
-    mutable Uint64      m_fontTextureId;       //!< The font texture id
+    String               m_string;                 //!< String to display
+    const Font*          m_font;                   //!< Font used to display the string
+    unsigned int         m_characterSize;          //!< Base size of characters, in pixels
+    float                m_letterSpacingFactor;    //!< Spacing factor between letters
+    float                m_lineSpacingFactor;      //!< Spacing factor between lines
+    Uint32               m_style;                  //!< Text style (see Style enum)
+    Color                m_fillColor;              //!< Text fill color
+    Color                m_outlineColor;           //!< Text outline color
+    float                m_outlineThickness;       //!< Thickness of the text's outline
+    mutable VertexArray  m_vertices;               //!< Vertex array containing the fill geometry
+    mutable VertexArray  m_outlineVertices;        //!< Vertex array containing the outline geometry
+    mutable FloatRect    m_bounds;                 //!< Bounding rectangle of the text (in local coordinates)
+    mutable bool         m_geometryNeedUpdate;     //!< Does the geometry need to be recomputed?
+    mutable Uint64       m_fontTextureId;          //!< The font texture id
+    bool                 m_frozen;                 //!< Is the geometry stored in a static vertex buffer?
+    mutable VertexBuffer m_frozenBuffer;           //!< Static vertex buffer holding the outline and fill geometry of a frozen text
+    mutable bool         m_frozenBufferNeedUpdate; //!< Does the vertex buffer need to be uploaded again?
 };
 
 } // namespace sf
@@ -490,6 +533,11 @@ private:
 /// used by a sf::Text (i.e. never write a function that
 /// uses a local sf::Font instance for creating a text).
 ///
+/// Labels that don't change can be frozen with setFrozen:
+/// their geometry is then kept in a static vertex buffer and
+/// drawn with a single draw call, and it isn't checked again
+/// when other texts load new glyphs into the same font page.
+///
 /// See also the note on coordinates and undistorted rendering in sf::Transformable.
 ///
 /// Usage example:
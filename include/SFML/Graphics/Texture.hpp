@@ -483,6 +483,42 @@ public:
     ////////////////////////////////////////////////////////////
     bool isRepeated() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the conversion of uploaded pixels
+    ///        to premultiplied alpha
+    ///
+    /// When enabled, the pixels passed to loadFromImage and to
+    /// the update functions that take an array of pixels or an
+    /// sf::Image are expected to have straight alpha, and their
+    /// color components are multiplied by their alpha before
+    /// being uploaded (see sf::Image::premultiplyAlpha). The
+    /// texture should then be drawn with sf::BlendPremultipliedAlpha,
+    /// and doesn't produce dark or light fringes around its
+    /// transparent areas when it is smoothed or mipmapped.
+    ///
+    /// Enabling the conversion doesn't affect the pixels that
+    /// are already in the texture, and pixels copied from
+    /// another texture or from a window are never converted.
+    /// Conversion is disabled by default.
+    ///
+    /// \param premultiplied True to convert uploaded pixels, false to upload them as they are
+    ///
+    /// \see isPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPremultipliedAlpha(bool premultiplied);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether uploaded pixels are converted to
+    ///        premultiplied alpha
+    ///
+    /// \return True if the conversion is enabled, false if it is disabled
+    ///
+    /// \see setPremultipliedAlpha
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isPremultipliedAlpha() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Generate a mipmap using the current texture data
     ///
@@ -616,16 +652,18 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Vector2u     m_size;          //!< Public texture size
-    Vector2u     m_actualSize;    //!< Actual texture size (can be greater than public size because of padding)
-    unsigned int m_texture;       //!< Internal texture identifier
-    bool         m_isSmooth;      //!< Status of the smooth filter
-    bool         m_sRgb;          //!< Should the texture source be converted from sRGB?
-    bool         m_isRepeated;    //!< Is the texture in repeat mode?
-    mutable bool m_pixelsFlipped; //!< To work around the inconsistency in Y orientation
-    bool         m_fboAttachment; //!< Is this texture owned by a framebuffer object?
-    bool         m_hasMipmap;     //!< Has the mipmap been generated?
-    Uint64       m_cacheId;       //!< Unique number that identifies the texture to the render target's cache
+    Vector2u     m_size;               //!< Public texture size
+    Vector2u     m_actualSize;         //!< Actual texture size (can be greater than public size because of padding)
+    unsigned int m_texture;            //!< Internal texture identifier
+    bool         m_isSmooth;           //!< Status of the smooth filter
+    bool         m_sRgb;               //!< Should the texture source be converted from sRGB?
+    bool         m_isRepeated;         //!< Is the texture in repeat mode?
+    bool         m_premultipliedAlpha; //!< Are uploaded pixels converted to premultiplied alpha?
+    mutable bool m_pixelsFlipped;      //!< To work around the inconsistency in Y orientation
+    bool         m_fboAttachment;      //!< Is this texture owned by a framebuffer object?
+    bool         m_hasMipmap;          //!< Has the mipmap been generated?
+    Uint64       m_cacheId;            //!< Unique number that identifies the texture to the render target's cache
+    Uint64       m_storageId;          //!< Unique number that changes when the texture is created or swapped, but not when its pixels are updated
 };
 
 } // namespace sf
@@ -673,6 +711,11 @@ private:
 /// that a pixel must be composed of 8 bits red, green, blue and
 /// alpha channels -- just like a sf::Color.
 ///
+/// Pixels can be converted to premultiplied alpha as they are
+/// uploaded, see setPremultipliedAlpha. Such textures must be
+/// drawn with sf::BlendPremultipliedAlpha, but can be smoothed,
+/// mipmapped and composited without color fringes.
+///
 /// Usage example:
 /// \code
 /// // This example shows the most common use of sf::Texture:
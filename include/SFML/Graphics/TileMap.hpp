@@ -0,0 +1,374 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TILEMAP_HPP
+#define SFML_TILEMAP_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <map>
+#include <set>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+class View;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable grid of tiles taken from a tileset texture
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Value of a cell of the map that has no tile
+    ///
+    ////////////////////////////////////////////////////////////
+    static const unsigned int EmptyTile;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty map.
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the map
+    ///
+    /// All the cells of the new map are empty. The map is
+    /// split into square chunks of \a chunkSize x \a chunkSize
+    /// tiles, which are uploaded and drawn independently.
+    ///
+    /// \param size      Size of the map, in tiles
+    /// \param tileSize  Size of a tile, in pixels of the tileset and in local units
+    /// \param chunkSize Size of a chunk, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    void create(const Vector2u& size, const Vector2u& tileSize, unsigned int chunkSize = 32);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tileset texture of the map
+    ///
+    /// Tiles are numbered from left to right and from top
+    /// to bottom in the tileset. The texture must exist as
+    /// long as the map uses it; if its size changes, this
+    /// function must be called again.
+    ///
+    /// \param texture New tileset texture
+    ///
+    /// \see getTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset texture of the map
+    ///
+    /// \return Pointer to the tileset texture, or NULL if none was set
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tile of a cell
+    ///
+    /// Only the vertices of this tile are sent to the
+    /// graphics card on the next draw.
+    ///
+    /// \param x    Column of the cell
+    /// \param y    Row of the cell
+    /// \param tile Index of the tile in the tileset, or EmptyTile
+    ///
+    /// \see getTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(unsigned int x, unsigned int y, unsigned int tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tiles of all the cells
+    ///
+    /// \param tiles Array of size.x * size.y tile indices, row by row
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTiles(const unsigned int* tiles);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tile of a cell
+    ///
+    /// \param x Column of the cell
+    /// \param y Row of the cell
+    ///
+    /// \return Index of the tile in the tileset, or EmptyTile
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getTile(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make a tile animated
+    ///
+    /// The frames of an animated tile must be stored next to
+    /// each other on the same row of the tileset, starting with
+    /// \a tile itself. A frame count of 1 removes the animation.
+    ///
+    /// \param tile       Index of the first frame in the tileset
+    /// \param frameCount Number of frames of the animation
+    ///
+    /// \see setAnimationFrame
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileAnimation(unsigned int tile, unsigned int frameCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current frame of the animated tiles
+    ///
+    /// Each animated tile displays the frame \a frame modulo
+    /// its frame count. Changing the frame only updates the
+    /// texture coordinates of the animated tiles, which are
+    /// sent to the graphics card on the next draw.
+    ///
+    /// \param frame Current animation frame
+    ///
+    /// \see setTileAnimation
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAnimationFrame(unsigned int frame);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the map
+    ///
+    /// \return Local bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the map
+    ///
+    /// \return Global bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of chunks of the map
+    ///
+    /// \return Number of chunks in each direction
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2u getChunkCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of vertices of a chunk
+    ///
+    /// \param x Column of the chunk
+    /// \param y Row of the chunk
+    ///
+    /// \return Number of vertices of the chunk, 6 per cell
+    ///
+    /// \see getChunkVertices
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getChunkVertexCount(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the vertices of a chunk
+    ///
+    /// Each cell of the chunk is made of two triangles, and the
+    /// cells are stored row by row. The vertices of empty cells
+    /// are degenerate.
+    ///
+    /// \param x Column of the chunk
+    /// \param y Row of the chunk
+    ///
+    /// \return Pointer to the vertices of the chunk
+    ///
+    /// \see getChunkVertexCount
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vertex* getChunkVertices(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the range of chunks that intersect a view
+    ///
+    /// These are the chunks that are drawn when the map is
+    /// drawn with the view. The transform of the map is taken
+    /// into account, \a transform is the one of the render
+    /// states that the map is drawn with.
+    ///
+    /// \param view      View that the map is drawn with
+    /// \param transform Transform applied to the map on top of its own
+    ///
+    /// \return Columns and rows of the chunks in view, empty if none is
+    ///
+    ////////////////////////////////////////////////////////////
+    IntRect getVisibleChunks(const View& view, const Transform& transform = Transform::Identity) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible chunks of the map to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the vertices of a cell
+    ///
+    /// \param x Column of the cell
+    /// \param y Row of the cell
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateTileVertices(unsigned int x, unsigned int y);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the vertices of all the cells
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateAllVertices();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief A square block of tiles drawn with a single vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        Chunk();
+
+        unsigned int             width;         //!< Number of columns of the chunk
+        std::vector<Vertex>      vertices;      //!< Vertices of the tiles, 6 per tile
+        std::vector<std::size_t> dirtyTiles;    //!< Tiles changed since the last upload
+        std::set<std::size_t>    animatedTiles; //!< Animated tiles of the chunk
+        bool                     needUpload;    //!< Must the whole chunk be uploaded?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send the modified vertices of a chunk to its vertex buffer
+    ///
+    /// \param chunk  Chunk to upload
+    /// \param buffer Vertex buffer of the chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    static void upload(Chunk& chunk, VertexBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u                             m_size;       //!< Size of the map, in tiles
+    Vector2u                             m_tileSize;   //!< Size of a tile, in pixels
+    unsigned int                         m_chunkSize;  //!< Size of a chunk, in tiles
+    Vector2u                             m_chunkCount; //!< Number of chunks in each direction
+    std::vector<unsigned int>            m_tiles;      //!< Tile of each cell
+    std::map<unsigned int, unsigned int> m_animations; //!< Frame count of the animated tiles
+    unsigned int                         m_frame;      //!< Current animation frame
+    const Texture*                       m_texture;    //!< Tileset texture
+    mutable std::vector<Chunk>           m_chunks;     //!< Chunks of the map, row by row
+    mutable std::vector<VertexBuffer>    m_buffers;    //!< Vertex buffers of the chunks, created on the first draw
+};
+
+} // namespace sf
+
+
+#endif // SFML_TILEMAP_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// sf::TileMap draws a rectangular grid of cells, each one
+/// displaying a tile picked from a tileset texture. It is
+/// designed for large static tile layers: the map is split
+/// into square chunks, the geometry of each chunk is sent
+/// once to the graphics card in a static sf::VertexBuffer,
+/// and only the chunks that intersect the current view of
+/// the render target are drawn.
+///
+/// Changing a single tile only sends the vertices of that
+/// tile to the graphics card, during the next draw. If
+/// vertex buffers are not available on the system, the
+/// chunks are drawn from their vertex arrays instead.
+///
+/// Animated tiles are supported by offsetting their texture
+/// coordinates by a whole number of tiles: changing the
+/// current frame only sends the vertices of the animated
+/// tiles to the graphics card, so it can be done every frame.
+///
+/// Usage example:
+/// \code
+/// sf::Texture tileset;
+/// tileset.loadFromFile("tileset.png");
+///
+/// sf::TileMap map;
+/// map.create(sf::Vector2u(1024, 1024), sf::Vector2u(16, 16));
+/// map.setTexture(tileset);
+/// map.setTiles(level.data());
+///
+/// // Water (tile 12) has 4 frames: tiles 12, 13, 14 and 15
+/// map.setTileAnimation(12, 4);
+///
+/// // In the main loop
+/// map.setAnimationFrame(static_cast<unsigned int>(clock.getElapsedTime().asSeconds() * 8.f));
+/// window.draw(map);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::Texture
+///
+////////////////////////////////////////////////////////////
@@ -31,10 +31,13 @@
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <cstddef>
 
 
 namespace sf
 {
+class Vertex;
+
 ////////////////////////////////////////////////////////////
 /// \brief Define a 3x3 transform matrix
 ///
@@ -146,6 +149,26 @@ public:
     ////////////////////////////////////////////////////////////
     FloatRect transformRect(const FloatRect& rectangle) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform the positions of an array of vertices
+    ///
+    /// The position of each input vertex is transformed and
+    /// written to the corresponding output vertex, along with
+    /// its unchanged color and texture coordinates. This gives
+    /// the same result as calling transformPoint for every
+    /// vertex, but uses SIMD instructions when the target
+    /// processor supports them.
+    ///
+    /// \a input and \a output may point to the same array, but
+    /// must not partially overlap.
+    ///
+    /// \param input  Pointer to the vertices to transform
+    /// \param output Pointer to the array receiving the transformed vertices
+    /// \param count  Number of vertices to transform
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformPoints(const Vertex* input, Vertex* output, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Combine the current transform with another one
     ///
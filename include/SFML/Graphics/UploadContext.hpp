@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_UPLOADCONTEXT_HPP
+#define SFML_UPLOADCONTEXT_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Window/GlResource.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+
+
+namespace sf
+{
+class Context;
+
+////////////////////////////////////////////////////////////
+/// \brief Context used to create and fill graphics
+///        resources on a worker thread
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UploadContext : GlResource, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle used to know when the uploads issued on
+    ///        an upload context are complete
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API Fence : GlResource, NonCopyable
+    {
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// A fence that was never submitted is always ready.
+        ///
+        ////////////////////////////////////////////////////////////
+        Fence();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        ////////////////////////////////////////////////////////////
+        ~Fence();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Check whether the uploads guarded by the fence are complete
+        ///
+        /// This function never blocks. It can be called from any
+        /// thread, typically once per frame on the rendering thread.
+        ///
+        /// \return True if the resources can be used for rendering
+        ///
+        /// \see wait
+        ///
+        ////////////////////////////////////////////////////////////
+        bool isReady() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Wait until the uploads guarded by the fence are complete
+        ///
+        /// \param timeout Maximum time to wait
+        ///
+        /// \return True if the uploads completed before the timeout expired
+        ///
+        /// \see isReady
+        ///
+        ////////////////////////////////////////////////////////////
+        bool wait(Time timeout) const;
+
+    private:
+
+        friend class UploadContext;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Release the OpenGL sync object of the fence, if any
+        ///
+        ////////////////////////////////////////////////////////////
+        void reset() const;
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        mutable void* m_sync; //!< OpenGL sync object, NULL once signaled
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Takes a context from the pool of upload contexts, or
+    /// creates a new one if all of them are in use, and
+    /// activates it on the calling thread. The context shares
+    /// its resources with all the other contexts.
+    ///
+    ////////////////////////////////////////////////////////////
+    UploadContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Flushes the pending commands, deactivates the context
+    /// and gives it back to the pool so that another worker
+    /// can reuse it without creating a new one. If the pool
+    /// is full, the context is destroyed instead.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UploadContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make a fence signal when the uploads issued so far are complete
+    ///
+    /// This function must be called on the thread the upload
+    /// context is active on, after the resources have been
+    /// created and filled. It doesn't wait for the uploads:
+    /// the fence can then be handed to the rendering thread,
+    /// which polls or waits on it before using the resources.
+    ///
+    /// If the fence was already submitted, its previous state
+    /// is discarded. If the system doesn't support sync
+    /// objects, this function waits for the uploads to
+    /// complete and the fence is immediately ready.
+    ///
+    /// \param fence Fence to signal
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit(Fence& fence);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the system supports asynchronous fences
+    ///
+    /// \return True if fences can be signaled without blocking the worker thread
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isFenceAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the contexts of the pool
+    ///
+    /// The contexts that upload contexts currently use are not
+    /// affected, they go back to the pool when their upload
+    /// context is destroyed. This function is typically called
+    /// once the workers have finished loading, and before the
+    /// program exits: the pooled contexts are not destroyed
+    /// automatically.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void releaseUnusedContexts();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Context* m_context; //!< Context taken from the pool
+};
+
+} // namespace sf
+
+
+#endif // SFML_UPLOADCONTEXT_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UploadContext
+/// \ingroup graphics
+///
+/// sf::UploadContext makes it possible to load graphics
+/// resources (sf::Texture, sf::VertexBuffer, sf::Shader...)
+/// on worker threads, for example while streaming a level,
+/// without blocking the rendering thread.
+///
+/// Constructing an upload context activates an OpenGL context
+/// that shares its resources with all the other contexts on
+/// the calling thread. Resources created and updated while it
+/// is alive go through it, and become usable by the rendering
+/// thread once the GPU has executed the uploads. The upload
+/// contexts are kept in a small pool and reused, so that
+/// workers don't pay for a context creation each time they
+/// start a new job; releaseUnusedContexts() destroys them
+/// once they are no longer needed.
+///
+/// Once the resources are filled, the worker submits a
+/// sf::UploadContext::Fence. The rendering thread checks it
+/// with isReady() every frame, or blocks on it with wait(),
+/// and only starts drawing the resources once it is ready.
+/// A fence, as well as the resources it guards, must outlive
+/// the handoff: the worker must not destroy them while the
+/// rendering thread may still use them.
+///
+/// Usage example:
+/// \code
+/// // Shared between the threads
+/// sf::Texture texture;
+/// sf::UploadContext::Fence fence;
+///
+/// // On a worker thread
+/// {
+///     sf::UploadContext context;
+///     texture.loadFromFile("level2.png");
+///     context.submit(fence);
+/// }
+/// // ...signal the rendering thread, e.g. with a flag protected by a mutex
+///
+/// // On the rendering thread, every frame
+/// if (workerDone && fence.isReady())
+///     window.draw(sf::Sprite(texture));
+/// \endcode
+///
+/// \see sf::Context
+///
+////////////////////////////////////////////////////////////
@@ -80,6 +80,11 @@ public:
     ///
     /// \param index Index of the vertex to get
     ///
+    /// Since the vertex may be modified through the returned
+    /// reference, calling this function invalidates the bounds
+    /// cached by getBounds. The reference must therefore not be
+    /// kept to modify the vertex after getBounds has been called.
+    ///
     /// \return Reference to the index-th vertex
     ///
     /// \see getVertexCount
@@ -166,6 +171,11 @@ public:
     /// This function returns the minimal axis-aligned rectangle
     /// that contains all the vertices of the array.
     ///
+    /// The bounds are cached: they are only computed again after
+    /// vertices have been accessed for writing or removed, and
+    /// vertices added with append or resize extend them without
+    /// scanning the whole array.
+    ///
     /// \return Bounding rectangle of the vertex array
     ///
     ////////////////////////////////////////////////////////////
@@ -187,8 +197,11 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<Vertex> m_vertices;      //!< Vertices contained in the array
-    PrimitiveType       m_primitiveType; //!< Type of primitives to draw
+    std::vector<Vertex> m_vertices;         //!< Vertices contained in the array
+    PrimitiveType       m_primitiveType;    //!< Type of primitives to draw
+    mutable Vector2f    m_boundsMin;        //!< Top-left corner of the cached bounds
+    mutable Vector2f    m_boundsMax;        //!< Bottom-right corner of the cached bounds
+    mutable bool        m_boundsNeedUpdate; //!< Do the cached bounds need to be computed again?
 };
 
 } // namespace sf
@@ -73,6 +73,19 @@ public:
     ////////////////////////////////////////////////////////////
     Time restart();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current time of the system's monotonic clock
+    ///
+    /// The time is measured from an arbitrary origin that doesn't
+    /// change while the program runs; all clocks measure time
+    /// with it. It is the time base of event timestamps
+    /// (see sf::Event::timestamp).
+    ///
+    /// \return Current time
+    ///
+    ////////////////////////////////////////////////////////////
+    static Time getCurrentTime();
+
 private:
 
     ////////////////////////////////////////////////////////////
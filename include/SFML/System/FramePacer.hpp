@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_FRAMEPACER_HPP
+#define SFML_FRAMEPACER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Utility class that paces a loop to a fixed
+///        frequency with sub-millisecond precision
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API FramePacer
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of buckets in the frame time histogram
+    ///
+    ////////////////////////////////////////////////////////////
+    static const std::size_t HistogramSize = 128;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Width of a bucket of the frame time histogram, in microseconds
+    ///
+    ////////////////////////////////////////////////////////////
+    static const Int64 HistogramBucketWidth = 250;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the frames paced so far
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        Uint64 frameCount;               //!< Number of frames measured
+        Uint64 missedDeadlineCount;      //!< Number of frames that ended after their deadline
+        Time   minFrameTime;             //!< Shortest frame time
+        Time   maxFrameTime;             //!< Longest frame time
+        Time   totalFrameTime;           //!< Sum of all the frame times
+        Uint64 histogram[HistogramSize]; //!< Number of frames per bucket of frame time, the last bucket also counts all the longer frames
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates a pacer without frame time, which only
+    /// measures the frames without waiting.
+    ///
+    ////////////////////////////////////////////////////////////
+    FramePacer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a pacer for a given frame time
+    ///
+    /// \param frameTime Target duration of a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit FramePacer(Time frameTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the target duration of a frame
+    ///
+    /// The deadlines are restarted from the current time.
+    ///
+    /// \param frameTime Target duration of a frame, or Time::Zero to disable pacing
+    ///
+    /// \see getFrameTime
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFrameTime(Time frameTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the target duration of a frame
+    ///
+    /// \return Target duration of a frame
+    ///
+    /// \see setFrameTime
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getFrameTime() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable spinning
+    ///
+    /// When spinning is enabled (the default), the pacer sleeps
+    /// until it is close to the deadline and then busy-waits
+    /// for the remaining time. When it is disabled, the pacer
+    /// only sleeps, which is less precise but leaves the CPU
+    /// idle; this is the right choice when another mechanism,
+    /// such as vertical synchronization, already provides a
+    /// precise wake-up.
+    ///
+    /// \param enabled True to enable spinning, false to disable it
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSpinEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current sleep margin
+    ///
+    /// The margin is the amount of time before the deadline at
+    /// which the pacer stops sleeping and starts spinning. It
+    /// is calibrated continuously from the measured overshoot
+    /// of sf::sleep.
+    ///
+    /// \return Current sleep margin
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getSleepMargin() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restart the deadlines from the current time
+    ///
+    /// This function should be called after a pause, so that
+    /// the pacer doesn't count the pause as a missed deadline.
+    ///
+    ////////////////////////////////////////////////////////////
+    void restart();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the end of the current frame
+    ///
+    /// If the deadline of the current frame has already passed,
+    /// this function returns immediately and counts a missed
+    /// deadline.
+    ///
+    /// \return Duration of the frame that just ended
+    ///
+    ////////////////////////////////////////////////////////////
+    Time wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the frames paced so far
+    ///
+    /// \return Frame statistics
+    ///
+    /// \see resetStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    const Statistics& getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the frame statistics
+    ///
+    /// \see getStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sleep, then spin until a deadline
+    ///
+    /// \param deadline Time of the clock to wait for
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitUntil(Time deadline);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a frame to the statistics
+    ///
+    /// \param frameTime Duration of the frame
+    /// \param missed    Did the frame miss its deadline?
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordFrame(Time frameTime, bool missed);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Clock      m_clock;       //!< Clock measuring the time since the last restart
+    Time       m_frameTime;   //!< Target duration of a frame
+    Time       m_deadline;    //!< End of the current frame, relative to the clock
+    Time       m_frameStart;  //!< Start of the current frame, relative to the clock
+    Time       m_sleepMargin; //!< Time before the deadline at which sleeping stops
+    bool       m_spinEnabled; //!< Busy-wait after sleeping?
+    Statistics m_statistics;  //!< Statistics of the paced frames
+};
+
+} // namespace sf
+
+
+#endif // SFML_FRAMEPACER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FramePacer
+/// \ingroup system
+///
+/// sf::FramePacer makes a loop run at a fixed frequency. A
+/// plain call to sf::sleep for the remainder of each frame
+/// isn't precise: the operating system wakes the thread up
+/// late by up to its scheduler granularity, and the error is
+/// different on every frame. sf::FramePacer avoids this in
+/// two ways:
+/// \li it sleeps until it is close to the deadline, then
+///     busy-waits with an sf::Clock for the remaining time;
+///     the margin kept for the busy wait is calibrated from
+///     the measured precision of sf::sleep
+/// \li deadlines are cumulative: the end of a frame is the
+///     end of the previous one plus the frame time, so the
+///     small errors of each frame don't accumulate into a
+///     drift of the average frequency
+///
+/// When a frame runs late, its deadline is counted as missed.
+/// If it is late by more than a whole frame, the deadlines
+/// are restarted from the current time instead of trying to
+/// catch up with a burst of short frames.
+///
+/// The pacer also keeps statistics about the frames: their
+/// count, minimum, maximum and total duration, a histogram
+/// of the frame times and the number of missed deadlines.
+///
+/// sf::Window uses a frame pacer to implement its framerate
+/// limit.
+///
+/// Usage example:
+/// \code
+/// sf::FramePacer pacer(sf::seconds(1.f / 120.f));
+/// while (running)
+/// {
+///     update();
+///     render();
+///     pacer.wait();
+/// }
+///
+/// const sf::FramePacer::Statistics& statistics = pacer.getStatistics();
+/// std::cout << statistics.missedDeadlineCount << " frames out of "
+///           << statistics.frameCount << " missed their deadline" << std::endl;
+/// \endcode
+///
+/// \see sf::Clock, sf::sleep
+///
+////////////////////////////////////////////////////////////
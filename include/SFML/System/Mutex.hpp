@@ -72,6 +72,20 @@ public:
     ////////////////////////////////////////////////////////////
     void lock();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Try to lock the mutex without blocking
+    ///
+    /// If the mutex is already locked in another thread,
+    /// this function returns false immediately instead of
+    /// waiting for it to be released.
+    ///
+    /// \return True if the mutex was locked, false otherwise
+    ///
+    /// \see lock, unlock
+    ///
+    ////////////////////////////////////////////////////////////
+    bool tryLock();
+
     ////////////////////////////////////////////////////////////
     /// \brief Unlock the mutex
     ///
@@ -109,6 +109,43 @@ public:
     ////////////////////////////////////////////////////////////
     static GlFunctionPointer getFunction(const char* name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Request OpenGL contexts that don't need a display
+    ///
+    /// On Linux and BSD with desktop OpenGL, contexts are normally
+    /// created through the X display. Headless contexts are created
+    /// through EGL instead, on a display that needs no window
+    /// system (Mesa's surfaceless platform or an EGL device), so
+    /// that sf::RenderTexture and sf::Context can be used on
+    /// servers and in continuous integration. SFML uses them
+    /// automatically when the X display can't be opened; this
+    /// function forces them even if a display is available, for
+    /// example to keep parallel batch jobs off the X server.
+    ///
+    /// The type of contexts is chosen when the first OpenGL
+    /// resource is created, and kept until all of them are
+    /// destroyed: this function must be called before. Windows
+    /// can't be displayed while headless contexts are used.
+    ///
+    /// This function has no effect on other platforms.
+    ///
+    /// \param enabled True to request headless contexts
+    ///
+    /// \see isHeadless
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setHeadlessEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether OpenGL contexts are headless
+    ///
+    /// \return True if the current contexts were created without a display
+    ///
+    /// \see setHeadlessEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isHeadless();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the currently active context
     ///
@@ -132,6 +169,38 @@ public:
     ////////////////////////////////////////////////////////////
     static Uint64 getActiveContextId();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times the global context lock was acquired
+    ///
+    /// SFML serializes the creation of contexts and the
+    /// management of the shared context on a single global
+    /// lock. Activating a context that was already created
+    /// doesn't take it.
+    ///
+    /// \return Number of acquisitions since the program started
+    ///
+    /// \see getLockContentionCount
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getLockAcquisitionCount();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times the global context lock was contended
+    ///
+    /// This is the number of acquisitions of the global
+    /// context lock for which the calling thread had to wait
+    /// because another thread was holding it. It can be
+    /// compared with getLockAcquisitionCount() to check
+    /// whether the threads of a program that render in
+    /// parallel are slowed down by context management.
+    ///
+    /// \return Number of contended acquisitions since the program started
+    ///
+    /// \see getLockAcquisitionCount
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getLockContentionCount();
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct a in-memory context
     ///
@@ -33,6 +33,7 @@
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
 #include <SFML/Window/Sensor.hpp>
+#include <SFML/System/Time.hpp>
 
 
 namespace sf
@@ -87,6 +88,16 @@ public:
         int y; //!< Y position of the mouse pointer, relative to the top of the owner window
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Raw mouse move event parameters (MouseMovedRaw)
+    ///
+    ////////////////////////////////////////////////////////////
+    struct MouseMoveRawEvent
+    {
+        float deltaX; //!< Horizontal motion reported by the device, without acceleration nor clamping to the screen
+        float deltaY; //!< Vertical motion reported by the device, without acceleration nor clamping to the screen
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Mouse buttons events parameters
     ///        (MouseButtonPressed, MouseButtonReleased)
@@ -209,6 +220,7 @@ public:
         TouchMoved,             //!< A touch moved (data in event.touch)
         TouchEnded,             //!< A touch event ended (data in event.touch)
         SensorChanged,          //!< A sensor value changed (data in event.sensor)
+        MouseMovedRaw,          //!< The mouse device moved (data in event.mouseMoveRaw)
 
         Count                   //!< Keep last -- the total number of event types
     };
@@ -216,7 +228,8 @@ public:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    EventType type; //!< Type of the event
+    EventType type;      //!< Type of the event
+    Time      timestamp; //!< Time at which the system generated the event, in the time base of sf::Clock::getCurrentTime(), or zero if unknown
 
     union
     {
@@ -224,6 +237,7 @@ public:
         KeyEvent              key;               //!< Key event parameters (Event::KeyPressed, Event::KeyReleased)
         TextEvent             text;              //!< Text event parameters (Event::TextEntered)
         MouseMoveEvent        mouseMove;         //!< Mouse move event parameters (Event::MouseMoved)
+        MouseMoveRawEvent     mouseMoveRaw;      //!< Raw mouse move event parameters (Event::MouseMovedRaw)
         MouseButtonEvent      mouseButton;       //!< Mouse button event parameters (Event::MouseButtonPressed, Event::MouseButtonReleased)
         MouseWheelEvent       mouseWheel;        //!< Mouse wheel event parameters (Event::MouseWheelMoved) (deprecated)
         MouseWheelScrollEvent mouseWheelScroll;  //!< Mouse wheel event parameters (Event::MouseWheelScrolled)
@@ -260,6 +274,26 @@ public:
 /// event.key member, all other members such as event.mouseMove
 /// or event.text will have undefined values.
 ///
+/// Events that come from an input device also carry the time
+/// at which the system generated them, in event.timestamp.
+/// It is converted to the time base of the system's monotonic
+/// clock, returned by sf::Clock::getCurrentTime(), so the
+/// difference between two events gives the input rate, and the
+/// difference between sf::Clock::getCurrentTime() and an event
+/// gives the time it spent waiting to be handled. With X11, the
+/// server time has a resolution of one millisecond; when the
+/// server doesn't run on the same clock (for example on another
+/// machine), the origin is estimated from the first event, so
+/// the measured latency lacks the delivery time of that event.
+/// Events for which the system doesn't provide a time have a
+/// zero timestamp.
+///
+/// MouseMovedRaw events report the motion of the mouse
+/// device itself, before the system applies acceleration and
+/// clamps the cursor to the screen. They are meant for camera
+/// controls and are only generated while the window has the
+/// focus, on platforms that support them.
+///
 /// Usage example:
 /// \code
 /// sf::Event event;
@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_INPUTSNAPSHOT_HPP
+#define SFML_INPUTSNAPSHOT_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Export.hpp>
+#include <SFML/Window/Joystick.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <SFML/System/Vector2.hpp>
+
+
+namespace sf
+{
+class Event;
+
+////////////////////////////////////////////////////////////
+/// \brief State of the keyboard, mouse and joysticks as
+///        seen through the events of a window
+///
+////////////////////////////////////////////////////////////
+class SFML_WINDOW_API InputSnapshot
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates a snapshot where no key or button is pressed,
+    /// no joystick is connected and the mouse is at (0, 0).
+    ///
+    ////////////////////////////////////////////////////////////
+    InputSnapshot();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the snapshot with an event
+    ///
+    /// Windows call this function for every event they
+    /// return, it only needs to be called directly to
+    /// maintain a snapshot from a custom source of events.
+    ///
+    /// \param event Event to apply
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const Event& event);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a key was pressed
+    ///
+    /// \param key Key to check
+    ///
+    /// \return True if the key was pressed, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isKeyPressed(Keyboard::Key key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a mouse button was pressed
+    ///
+    /// \param button Button to check
+    ///
+    /// \return True if the button was pressed, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isButtonPressed(Mouse::Button button) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of the mouse cursor
+    ///
+    /// \return Last known position of the mouse, relative to the window
+    ///
+    ////////////////////////////////////////////////////////////
+    Vector2i getMousePosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if the mouse cursor was inside the window
+    ///
+    /// \return True if the mouse cursor was inside the window
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isMouseInside() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if the window had the input focus
+    ///
+    /// \return True if the window had the focus
+    ///
+    ////////////////////////////////////////////////////////////
+    bool hasFocus() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a joystick was connected
+    ///
+    /// \param joystick Index of the joystick
+    ///
+    /// \return True if the joystick was connected
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isJoystickConnected(unsigned int joystick) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a joystick button was pressed
+    ///
+    /// \param joystick Index of the joystick
+    /// \param button   Button to check
+    ///
+    /// \return True if the button was pressed
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isJoystickButtonPressed(unsigned int joystick, unsigned int button) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a joystick axis
+    ///
+    /// \param joystick Index of the joystick
+    /// \param axis     Axis to check
+    ///
+    /// \return Last reported position of the axis, in range [-100 .. 100]
+    ///
+    ////////////////////////////////////////////////////////////
+    float getJoystickAxisPosition(unsigned int joystick, Joystick::Axis axis) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release all the keys and mouse buttons
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseKeyboardAndMouse();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    bool     m_keys[Keyboard::KeyCount];                                 //!< State of the keys
+    bool     m_buttons[Mouse::ButtonCount];                              //!< State of the mouse buttons
+    Vector2i m_mousePosition;                                            //!< Last position of the mouse
+    bool     m_mouseInside;                                              //!< Is the mouse cursor inside the window?
+    bool     m_focus;                                                    //!< Does the window have the focus?
+    bool     m_joystickConnected[Joystick::Count];                       //!< Connection state of the joysticks
+    bool     m_joystickButtons[Joystick::Count][Joystick::ButtonCount];  //!< State of the joystick buttons
+    float    m_joystickAxes[Joystick::Count][Joystick::AxisCount];       //!< Position of the joystick axes
+};
+
+} // namespace sf
+
+
+#endif // SFML_INPUTSNAPSHOT_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::InputSnapshot
+/// \ingroup window
+///
+/// sf::Keyboard, sf::Mouse and sf::Joystick query the
+/// operating system every time they are called; on X11 each
+/// query is a round trip to the display server. sf::InputSnapshot
+/// is a plain copy of the input state instead, maintained from
+/// the events that a window returns through pollEvent,
+/// pollEvents or waitEvent.
+///
+/// A window updates its snapshot on the thread that processes
+/// its events, and sf::Window::getInputSnapshot() returns a
+/// consistent copy of it from any thread. A simulation thread
+/// typically takes one copy per tick; all the queries made on
+/// that copy are then simple memory reads, and they all see
+/// the same state even if new events are processed meanwhile.
+///
+/// Because it is built from events, the snapshot reflects what
+/// the window received: keys and mouse buttons are released
+/// when the window loses the focus, and the mouse position is
+/// relative to the window and only changes while the cursor
+/// moves over it. Joystick events don't depend on the focus.
+///
+/// Usage example:
+/// \code
+/// // Event thread
+/// sf::Event event;
+/// while (window.waitEvent(event))
+/// {
+///     // ...
+/// }
+///
+/// // Simulation thread, once per tick
+/// sf::InputSnapshot input = window.getInputSnapshot();
+/// if (input.isKeyPressed(sf::Keyboard::Left))
+///     player.moveLeft();
+/// if (input.isButtonPressed(sf::Mouse::Left))
+///     player.fire(input.getMousePosition());
+/// \endcode
+///
+/// \see sf::Keyboard, sf::Mouse, sf::Joystick
+///
+////////////////////////////////////////////////////////////
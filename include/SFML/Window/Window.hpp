@@ -31,6 +31,7 @@
 #include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/GlResource.hpp>
 #include <SFML/Window/WindowBase.hpp>
+#include <SFML/System/FramePacer.hpp>
 
 
 namespace sf
@@ -201,6 +202,10 @@ public:
     ///
     /// Vertical synchronization is disabled by default.
     ///
+    /// When a framerate limit is also set, the window relies on
+    /// vertical synchronization for precise timing and only
+    /// sleeps to enforce the limit, instead of busy-waiting.
+    ///
     /// \param enabled True to enable v-sync, false to deactivate it
     ///
     ////////////////////////////////////////////////////////////
@@ -212,17 +217,33 @@ public:
     /// If a limit is set, the window will use a small delay after
     /// each call to display() to ensure that the current frame
     /// lasted long enough to match the framerate limit.
-    /// SFML will try to match the given limit as much as it can,
-    /// but since it internally uses sf::sleep, whose precision
-    /// depends on the underlying OS, the results may be a little
-    /// unprecise as well (for example, you can get 65 FPS when
-    /// requesting 60).
+    /// The delay is implemented with an sf::FramePacer: the
+    /// window sleeps until it is close to the end of the frame,
+    /// then busy-waits for the remaining time, so that the
+    /// frame times stay regular regardless of the precision
+    /// of sf::sleep on the underlying OS.
     ///
     /// \param limit Framerate limit, in frames per seconds (use 0 to disable limit)
     ///
+    /// \see getFrameStatistics
+    ///
     ////////////////////////////////////////////////////////////
     void setFramerateLimit(unsigned int limit);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get statistics about the frames displayed by the window
+    ///
+    /// A frame is measured from one call to display() to the
+    /// next. Missed deadlines are only counted when a framerate
+    /// limit is set.
+    ///
+    /// \return Frame statistics
+    ///
+    /// \see setFramerateLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    const FramePacer::Statistics& getFrameStatistics() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the window as the current target
     ///        for OpenGL rendering
@@ -251,6 +272,31 @@ public:
     ////////////////////////////////////////////////////////////
     void display();
 
+protected:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the back buffer is displayed
+    ///
+    /// This function is called by display(), while the window
+    /// is active, so that derived classes can read the frame
+    /// that is about to be displayed. If it returns false, the
+    /// buffers are not swapped and onPostDisplay is not called.
+    ///
+    /// \return True to display the back buffer, false to keep the current frame on screen
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool onPreDisplay();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called after the back buffer has been displayed
+    ///
+    /// This function is called by display(), while the window
+    /// is active, so that derived classes can prepare the new
+    /// back buffer, whose contents are undefined.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onPostDisplay();
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -277,8 +323,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     priv::GlContext*  m_context;        //!< Platform-specific implementation of the OpenGL context
-    Clock             m_clock;          //!< Clock for measuring the elapsed time between frames
-    Time              m_frameTimeLimit; //!< Current framerate limit
+    FramePacer        m_framePacer;     //!< Frame pacer measuring frames and enforcing the framerate limit
 };
 
 } // namespace sf
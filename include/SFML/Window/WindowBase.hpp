@@ -29,12 +29,15 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Cursor.hpp>
+#include <SFML/Window/Event.hpp>
 #include <SFML/Window/Export.hpp>
+#include <SFML/Window/InputSnapshot.hpp>
 #include <SFML/Window/VideoMode.hpp>
 #include <SFML/Window/Vulkan.hpp>
 #include <SFML/Window/WindowHandle.hpp>
 #include <SFML/Window/WindowStyle.hpp>
 #include <SFML/System/Clock.hpp>
+#include <SFML/System/Mutex.hpp>
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
@@ -47,8 +50,6 @@ namespace priv
     class WindowImpl;
 }
 
-class Event;
-
 ////////////////////////////////////////////////////////////
 /// \brief Window that serves as a base for other windows
 ///
@@ -169,6 +170,61 @@ public:
     ////////////////////////////////////////////////////////////
     bool pollEvent(Event& event);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Pop several events from the event queue at once
+    ///
+    /// This function is not blocking: it returns the events that
+    /// are pending, up to \a maxCount, and 0 if there's none.
+    /// It is equivalent to calling pollEvent() repeatedly, but
+    /// retrieves the events in bulk, which is cheaper when many
+    /// events arrive every frame (high-rate mice, text input...).
+    /// \code
+    /// sf::Event events[64];
+    /// std::size_t count;
+    /// while ((count = window.pollEvents(events, 64)) > 0)
+    /// {
+    ///     for (std::size_t i = 0; i < count; ++i)
+    ///     {
+    ///         // process events[i]...
+    ///     }
+    /// }
+    /// \endcode
+    ///
+    /// \param events   Array to copy the events to
+    /// \param maxCount Maximum number of events to return, size of \a events
+    ///
+    /// \return Number of events copied to \a events
+    ///
+    /// \see pollEvent, setEventCoalescing
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t pollEvents(Event* events, std::size_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the coalescing of a type of events
+    ///
+    /// When coalescing is enabled for a type of events, an
+    /// event that immediately follows a pending event of the
+    /// same type and source replaces it, so that only the most
+    /// recent value is returned. For example, the many
+    /// MouseMoved events generated between two frames by a
+    /// high-rate mouse collapse into a single one, as long as
+    /// no other event comes in between.
+    ///
+    /// Coalescing is supported for the Resized, MouseMoved,
+    /// JoystickMoved (per joystick and axis), TouchMoved (per
+    /// finger) and SensorChanged (per sensor) events, as well as
+    /// MouseMovedRaw events whose motions are summed; it has no
+    /// effect on other types. It is disabled by default.
+    ///
+    /// \param type    Type of events
+    /// \param enabled True to enable coalescing, false to disable it
+    ///
+    /// \see pollEvents
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEventCoalescing(Event::EventType type, bool enabled);
+
     ////////////////////////////////////////////////////////////
     /// \brief Wait for an event and return it
     ///
@@ -196,6 +252,52 @@ public:
     ////////////////////////////////////////////////////////////
     bool waitEvent(Event& event);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for an event during a limited time and return it
+    ///
+    /// This function is blocking: if there's no pending event then
+    /// it will wait until an event is received or until \a timeout
+    /// has elapsed. It is typically used by applications that only
+    /// redraw in response to input, but still need to wake up
+    /// regularly (for example to update an animation).
+    /// \code
+    /// sf::Event event;
+    /// while (window.waitEvent(event, sf::milliseconds(500)))
+    /// {
+    ///    // process event...
+    /// }
+    /// // update and redraw...
+    /// \endcode
+    ///
+    /// \param event   Event to be returned
+    /// \param timeout Maximum time to wait for an event
+    ///
+    /// \return True if an event was returned, or false if the timeout
+    ///         expired or an error occurred
+    ///
+    /// \see pollEvent
+    ///
+    ////////////////////////////////////////////////////////////
+    bool waitEvent(Event& event, Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a copy of the current input state of the window
+    ///
+    /// The window keeps track of the state of the keyboard, mouse
+    /// and joysticks from the events it returns through pollEvent,
+    /// pollEvents and waitEvent. This function returns a consistent
+    /// copy of that state and can be called from any thread, so
+    /// that a simulation thread can read the input once per tick
+    /// while another thread handles the events. Querying the
+    /// returned snapshot doesn't involve the operating system.
+    ///
+    /// \return Input state as of the last event returned by the window
+    ///
+    /// \see sf::InputSnapshot
+    ///
+    ////////////////////////////////////////////////////////////
+    InputSnapshot getInputSnapshot() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the position of the window
     ///
@@ -451,6 +553,12 @@ private:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the input snapshot to the current state of the devices
+    ///
+    ////////////////////////////////////////////////////////////
+    void initializeInputSnapshot();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the fullscreen window
     ///
@@ -470,8 +578,10 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    priv::WindowImpl* m_impl;           //!< Platform-specific implementation of the window
-    Vector2u          m_size;           //!< Current size of the window
+    priv::WindowImpl* m_impl;               //!< Platform-specific implementation of the window
+    Vector2u          m_size;               //!< Current size of the window
+    InputSnapshot     m_inputSnapshot;      //!< Input state built from the events returned to the user
+    mutable Mutex     m_inputSnapshotMutex; //!< Mutex protecting the input snapshot
 };
 
 } // namespace sf
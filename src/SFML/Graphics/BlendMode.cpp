@@ -39,6 +39,7 @@ const BlendMode BlendAdd(BlendMode::SrcAlpha, BlendMode::One, BlendMode::Add,
                          BlendMode::One, BlendMode::One, BlendMode::Add);
 const BlendMode BlendMultiply(BlendMode::DstColor, BlendMode::Zero);
 const BlendMode BlendNone(BlendMode::One, BlendMode::Zero);
+const BlendMode BlendPremultipliedAlpha(BlendMode::One, BlendMode::OneMinusSrcAlpha, BlendMode::Add);
 
 
 ////////////////////////////////////////////////////////////
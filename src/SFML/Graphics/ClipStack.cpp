@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ClipStack.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+    // Check if a matrix coefficient is zero, up to rounding errors
+    bool isZero(float value)
+    {
+        return std::fabs(value) < 1e-6f;
+    }
+
+    // Round a coordinate to the nearest pixel boundary
+    int roundToPixel(float value)
+    {
+        return static_cast<int>(std::floor(value + 0.5f));
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ClipStack::ClipStack(RenderTarget& target) :
+m_target      (target),
+m_clips       (),
+m_stencilDepth(0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void ClipStack::push(const FloatRect& rectangle, const Transform& transform)
+{
+    View view = m_target.getView();
+    Vector2u size = m_target.getSize();
+
+    // The rectangle can be applied with the scissor if it stays axis-aligned
+    // once projected, i.e. if the combined transform only scales, translates
+    // or rotates by a multiple of 90 degrees
+    Transform combined = view.getTransform() * transform;
+    const float* matrix = combined.getMatrix();
+
+    bool aligned = (isZero(matrix[1]) && isZero(matrix[4])) || (isZero(matrix[0]) && isZero(matrix[5]));
+
+    if (aligned && (size.x > 0) && (size.y > 0))
+    {
+        // Map two opposite corners to pixels, rounding edges like the rasterizer would
+        IntRect viewport = m_target.getViewport(view);
+        Vector2f first  = combined.transformPoint(rectangle.left, rectangle.top);
+        Vector2f second = combined.transformPoint(rectangle.left + rectangle.width, rectangle.top + rectangle.height);
+
+        float x1 = viewport.left + ( first.x  + 1.f) / 2.f * viewport.width;
+        float x2 = viewport.left + ( second.x + 1.f) / 2.f * viewport.width;
+        float y1 = viewport.top  + (-first.y  + 1.f) / 2.f * viewport.height;
+        float y2 = viewport.top  + (-second.y + 1.f) / 2.f * viewport.height;
+
+        int left   = roundToPixel(std::min(x1, x2));
+        int top    = roundToPixel(std::min(y1, y2));
+        int right  = roundToPixel(std::max(x1, x2));
+        int bottom = roundToPixel(std::max(y1, y2));
+
+        // Intersect with the current scissor rectangle, which holds the enclosing rectangle clips
+        IntRect current = m_target.getScissor(view);
+        IntRect scissor;
+        if (!IntRect(left, top, right - left, bottom - top).intersects(current, scissor))
+            scissor = IntRect(current.left, current.top, 0, 0);
+
+        Clip clip;
+        clip.stencil = false;
+        clip.previousScissor = view.getScissor();
+        clip.drawable = NULL;
+        m_clips.push_back(clip);
+
+        float width  = static_cast<float>(size.x);
+        float height = static_cast<float>(size.y);
+        view.setScissor(FloatRect(scissor.left / width, scissor.top / height, scissor.width / width, scissor.height / height));
+        m_target.setView(view);
+    }
+    else
+    {
+        Clip clip;
+        clip.stencil = true;
+        clip.drawable = NULL;
+        clip.states.transform = transform;
+        clip.quad[0].position = Vector2f(rectangle.left, rectangle.top);
+        clip.quad[1].position = Vector2f(rectangle.left + rectangle.width, rectangle.top);
+        clip.quad[2].position = Vector2f(rectangle.left + rectangle.width, rectangle.top + rectangle.height);
+        clip.quad[3].position = Vector2f(rectangle.left, rectangle.top + rectangle.height);
+        m_clips.push_back(clip);
+
+        drawStencilClip(clip, StencilMode::Increment);
+        ++m_stencilDepth;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ClipStack::push(const Drawable& drawable, const RenderStates& states)
+{
+    Clip clip;
+    clip.stencil = true;
+    clip.drawable = &drawable;
+    clip.states.transform = states.transform;
+    m_clips.push_back(clip);
+
+    drawStencilClip(clip, StencilMode::Increment);
+    ++m_stencilDepth;
+}
+
+
+////////////////////////////////////////////////////////////
+void ClipStack::pop()
+{
+    if (m_clips.empty())
+        return;
+
+    const Clip& clip = m_clips.back();
+
+    if (clip.stencil)
+    {
+        // Draw the region again to bring its pixels back to the enclosing depth
+        drawStencilClip(clip, StencilMode::Decrement);
+        --m_stencilDepth;
+    }
+    else
+    {
+        // Only the scissor is restored, other changes made to the view are kept
+        View view = m_target.getView();
+        view.setScissor(clip.previousScissor);
+        m_target.setView(view);
+    }
+
+    m_clips.pop_back();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ClipStack::getDepth() const
+{
+    return m_clips.size();
+}
+
+
+////////////////////////////////////////////////////////////
+StencilMode ClipStack::getStencilMode() const
+{
+    if (m_stencilDepth == 0)
+        return StencilMode();
+
+    return StencilMode(StencilMode::Equal, StencilMode::Keep, m_stencilDepth, ~0u, false);
+}
+
+
+////////////////////////////////////////////////////////////
+void ClipStack::draw(const Drawable& drawable, const RenderStates& states)
+{
+    RenderStates clippedStates = states;
+    clippedStates.stencilMode = getStencilMode();
+
+    m_target.draw(drawable, clippedStates);
+}
+
+
+////////////////////////////////////////////////////////////
+void ClipStack::drawStencilClip(const Clip& clip, StencilMode::UpdateOperation operation)
+{
+    // Only the pixels inside the current region are updated, and the color buffer is left untouched
+    RenderStates states = clip.states;
+    states.stencilMode = StencilMode(StencilMode::Equal, operation, m_stencilDepth, ~0u, true);
+
+    if (clip.drawable)
+        m_target.draw(*clip.drawable, states);
+    else
+        m_target.draw(clip.quad, 4, TriangleFan, states);
+}
+
+} // namespace sf
@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CommandList.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <algorithm>
+
+
+namespace
+{
+    // Number of vertices that make a single primitive of the given type,
+    // or 0 if consecutive draws of this type can't be merged together
+    std::size_t getMergeableVertexCount(sf::PrimitiveType type)
+    {
+        switch (type)
+        {
+            case sf::Points:    return 1;
+            case sf::Lines:     return 2;
+            case sf::Triangles: return 3;
+            case sf::Quads:     return 4;
+            default:            return 0;
+        }
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+CommandList::CommandList() :
+m_size        (0, 0),
+m_commands    (),
+m_vertices    (),
+m_views       (),
+m_mergeBarrier(0)
+{
+    m_commandList = this;
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+CommandList::CommandList(const Vector2u& size) :
+m_size        (size),
+m_commands    (),
+m_vertices    (),
+m_views       (),
+m_mergeBarrier(0)
+{
+    m_commandList = this;
+    initialize();
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::reset()
+{
+    // If a view was set on the list, it must be recorded again with the next command
+    m_cache.viewChanged = !m_views.empty();
+
+    m_commands.clear();
+    m_vertices.clear();
+    m_views.clear();
+    m_mergeBarrier = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CommandList::getCommandCount() const
+{
+    return m_commands.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CommandList::getVertexCount() const
+{
+    return m_vertices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u CommandList::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool CommandList::setActive(bool)
+{
+    // A command list never owns an OpenGL context
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::recordDraw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    recordView();
+
+    // Merge the draw with the previous one if they can be issued as a single draw call;
+    // since vertices are pre-transformed, only the other render states have to match
+    std::size_t primitiveSize = getMergeableVertexCount(type);
+    bool merged = false;
+
+    if (primitiveSize && (m_commands.size() > m_mergeBarrier))
+    {
+        Command& last = m_commands.back();
+
+        if ((last.type == DrawVertices) &&
+            (last.primitiveType == type) &&
+            (last.count % primitiveSize == 0) &&
+            (last.states.texture == states.texture) &&
+            (last.states.shader == states.shader) &&
+            (last.states.blendMode == states.blendMode) &&
+            (last.states.stencilMode == states.stencilMode))
+        {
+            last.count += vertexCount;
+            merged = true;
+        }
+    }
+
+    if (!merged)
+    {
+        Command command;
+        command.type = DrawVertices;
+        command.primitiveType = type;
+        command.states = states;
+        command.states.transform = Transform::Identity;
+        command.first = m_vertices.size();
+        command.count = vertexCount;
+        command.vertexBuffer = NULL;
+        command.stencilValue = 0;
+        m_commands.push_back(command);
+    }
+
+    // Copy the vertices into the arena, pre-transformed by the states' transform
+    std::size_t offset = m_vertices.size();
+    m_vertices.resize(offset + vertexCount);
+    Vertex* destination = &m_vertices[offset];
+
+    if (states.transform == Transform::Identity)
+    {
+        std::copy(vertices, vertices + vertexCount, destination);
+    }
+    else
+    {
+        states.transform.transformPoints(vertices, destination, vertexCount);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::recordDraw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
+{
+    recordView();
+
+    Command command;
+    command.type = DrawVertexBuffer;
+    command.primitiveType = vertexBuffer.getPrimitiveType();
+    command.states = states;
+    command.first = firstVertex;
+    command.count = vertexCount;
+    command.vertexBuffer = &vertexBuffer;
+    command.stencilValue = 0;
+    m_commands.push_back(command);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::recordClear(CommandType type, const Color& color, unsigned int value)
+{
+    recordView();
+
+    Command command;
+    command.type = type;
+    command.primitiveType = Points;
+    command.first = 0;
+    command.count = 0;
+    command.vertexBuffer = NULL;
+    command.color = color;
+    command.stencilValue = value;
+    m_commands.push_back(command);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::recordView()
+{
+    if (!m_cache.viewChanged)
+        return;
+
+    Command command;
+    command.type = SetView;
+    command.primitiveType = Points;
+    command.first = m_views.size();
+    command.count = 0;
+    command.vertexBuffer = NULL;
+    command.stencilValue = 0;
+    m_commands.push_back(command);
+
+    m_views.push_back(getView());
+    m_cache.viewChanged = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::replay(RenderTarget& target) const
+{
+    if (m_commands.empty())
+        return;
+
+    // Remember the view of the target, in case the list changes it
+    View previousView = target.getView();
+    bool viewChanged = false;
+
+    for (std::vector<Command>::const_iterator it = m_commands.begin(); it != m_commands.end(); ++it)
+    {
+        const Command& command = *it;
+
+        switch (command.type)
+        {
+            case DrawVertices:
+                target.draw(&m_vertices[command.first], command.count, command.primitiveType, command.states);
+                break;
+
+            case DrawVertexBuffer:
+                target.draw(*command.vertexBuffer, command.first, command.count, command.states);
+                break;
+
+            case ClearColor:
+                target.clear(command.color);
+                break;
+
+            case ClearStencil:
+                target.clear(command.stencilValue);
+                break;
+
+            case ClearBoth:
+                target.clear(command.color, command.stencilValue);
+                break;
+
+            case SetView:
+                target.setView(m_views[command.first]);
+                viewChanged = true;
+                break;
+        }
+    }
+
+    if (viewChanged)
+        target.setView(previousView);
+}
+
+} // namespace sf
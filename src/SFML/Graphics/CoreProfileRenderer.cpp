@@ -0,0 +1,673 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CoreProfileRenderer.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Window/Context.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#ifndef GL_STREAM_DRAW
+    #define GL_STREAM_DRAW 0x88E0
+#endif
+
+#ifndef GL_VERTEX_SHADER
+    #define GL_VERTEX_SHADER 0x8B31
+#endif
+
+#ifndef GL_FRAGMENT_SHADER
+    #define GL_FRAGMENT_SHADER 0x8B30
+#endif
+
+#ifndef GL_COMPILE_STATUS
+    #define GL_COMPILE_STATUS 0x8B81
+#endif
+
+#ifndef GL_LINK_STATUS
+    #define GL_LINK_STATUS 0x8B82
+#endif
+
+#ifndef GL_CONTEXT_FLAGS
+    #define GL_CONTEXT_FLAGS 0x821E
+#endif
+
+#ifndef GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT
+    #define GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT 0x00000001
+#endif
+
+#ifndef GL_CONTEXT_PROFILE_MASK
+    #define GL_CONTEXT_PROFILE_MASK 0x9126
+#endif
+
+#ifndef GL_CONTEXT_CORE_PROFILE_BIT
+    #define GL_CONTEXT_CORE_PROFILE_BIT 0x00000001
+#endif
+
+
+namespace
+{
+    // OpenGL 3.2 entry points used by the backend; the extension loader of
+    // sfml-graphics only knows about OpenGL 1.1 and extensions, and core
+    // profiles don't advertise most of the extensions it relies on
+    struct Functions
+    {
+        typedef void   (GLAPIENTRY *GenVertexArrays)(GLsizei, GLuint*);
+        typedef void   (GLAPIENTRY *DeleteVertexArrays)(GLsizei, const GLuint*);
+        typedef void   (GLAPIENTRY *BindVertexArray)(GLuint);
+        typedef void   (GLAPIENTRY *GenBuffers)(GLsizei, GLuint*);
+        typedef void   (GLAPIENTRY *DeleteBuffers)(GLsizei, const GLuint*);
+        typedef void   (GLAPIENTRY *BindBuffer)(GLenum, GLuint);
+        typedef void   (GLAPIENTRY *BufferData)(GLenum, GLsizeiptr, const void*, GLenum);
+        typedef void   (GLAPIENTRY *BufferSubData)(GLenum, GLintptr, GLsizeiptr, const void*);
+        typedef void   (GLAPIENTRY *EnableVertexAttribArray)(GLuint);
+        typedef void   (GLAPIENTRY *VertexAttribPointer)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*);
+        typedef GLuint (GLAPIENTRY *CreateShader)(GLenum);
+        typedef void   (GLAPIENTRY *ShaderSource)(GLuint, GLsizei, const GLchar* const*, const GLint*);
+        typedef void   (GLAPIENTRY *CompileShader)(GLuint);
+        typedef void   (GLAPIENTRY *GetShaderiv)(GLuint, GLenum, GLint*);
+        typedef void   (GLAPIENTRY *GetShaderInfoLog)(GLuint, GLsizei, GLsizei*, GLchar*);
+        typedef void   (GLAPIENTRY *DeleteShader)(GLuint);
+        typedef GLuint (GLAPIENTRY *CreateProgram)();
+        typedef void   (GLAPIENTRY *AttachShader)(GLuint, GLuint);
+        typedef void   (GLAPIENTRY *BindAttribLocation)(GLuint, GLuint, const GLchar*);
+        typedef void   (GLAPIENTRY *LinkProgram)(GLuint);
+        typedef void   (GLAPIENTRY *GetProgramiv)(GLuint, GLenum, GLint*);
+        typedef void   (GLAPIENTRY *GetProgramInfoLog)(GLuint, GLsizei, GLsizei*, GLchar*);
+        typedef void   (GLAPIENTRY *DeleteProgram)(GLuint);
+        typedef void   (GLAPIENTRY *UseProgram)(GLuint);
+        typedef GLint  (GLAPIENTRY *GetUniformLocation)(GLuint, const GLchar*);
+        typedef void   (GLAPIENTRY *Uniform1i)(GLint, GLint);
+        typedef void   (GLAPIENTRY *Uniform1f)(GLint, GLfloat);
+        typedef void   (GLAPIENTRY *UniformMatrix4fv)(GLint, GLsizei, GLboolean, const GLfloat*);
+        typedef void   (GLAPIENTRY *ActiveTexture)(GLenum);
+        typedef void   (GLAPIENTRY *BlendFuncSeparate)(GLenum, GLenum, GLenum, GLenum);
+        typedef void   (GLAPIENTRY *BlendEquationSeparate)(GLenum, GLenum);
+        typedef void   (GLAPIENTRY *DrawElementsBaseVertex)(GLenum, GLsizei, GLenum, const void*, GLint);
+
+        GenVertexArrays         genVertexArrays;
+        DeleteVertexArrays      deleteVertexArrays;
+        BindVertexArray         bindVertexArray;
+        GenBuffers              genBuffers;
+        DeleteBuffers           deleteBuffers;
+        BindBuffer              bindBuffer;
+        BufferData              bufferData;
+        BufferSubData           bufferSubData;
+        EnableVertexAttribArray enableVertexAttribArray;
+        VertexAttribPointer     vertexAttribPointer;
+        CreateShader            createShader;
+        ShaderSource            shaderSource;
+        CompileShader           compileShader;
+        GetShaderiv             getShaderiv;
+        GetShaderInfoLog        getShaderInfoLog;
+        DeleteShader            deleteShader;
+        CreateProgram           createProgram;
+        AttachShader            attachShader;
+        BindAttribLocation      bindAttribLocation;
+        LinkProgram             linkProgram;
+        GetProgramiv            getProgramiv;
+        GetProgramInfoLog       getProgramInfoLog;
+        DeleteProgram           deleteProgram;
+        UseProgram              useProgram;
+        GetUniformLocation      getUniformLocation;
+        Uniform1i               uniform1i;
+        Uniform1f               uniform1f;
+        UniformMatrix4fv        uniformMatrix4fv;
+        ActiveTexture           activeTexture;
+        BlendFuncSeparate       blendFuncSeparate;
+        BlendEquationSeparate   blendEquationSeparate;
+        DrawElementsBaseVertex  drawElementsBaseVertex;
+    };
+
+    Functions gl;
+
+    // Load a single entry point, returns false if it is missing
+    template <typename T>
+    bool loadFunction(T& function, const char* name)
+    {
+        function = reinterpret_cast<T>(sf::Context::getFunction(name));
+        return function != NULL;
+    }
+
+    // Mutex to protect the loading of the entry points, render targets can be created from several threads
+    sf::Mutex functionsMutex;
+
+    // Load all the entry points of the backend, returns false if any of them is missing
+    bool loadFunctions()
+    {
+        sf::Lock lock(functionsMutex);
+
+        static bool loaded = false;
+        static bool result = false;
+
+        if (!loaded)
+        {
+            loaded = true;
+            result = loadFunction(gl.genVertexArrays,         "glGenVertexArrays")         &&
+                     loadFunction(gl.deleteVertexArrays,      "glDeleteVertexArrays")      &&
+                     loadFunction(gl.bindVertexArray,         "glBindVertexArray")         &&
+                     loadFunction(gl.genBuffers,              "glGenBuffers")              &&
+                     loadFunction(gl.deleteBuffers,           "glDeleteBuffers")           &&
+                     loadFunction(gl.bindBuffer,              "glBindBuffer")              &&
+                     loadFunction(gl.bufferData,              "glBufferData")              &&
+                     loadFunction(gl.bufferSubData,           "glBufferSubData")           &&
+                     loadFunction(gl.enableVertexAttribArray, "glEnableVertexAttribArray") &&
+                     loadFunction(gl.vertexAttribPointer,     "glVertexAttribPointer")     &&
+                     loadFunction(gl.createShader,            "glCreateShader")            &&
+                     loadFunction(gl.shaderSource,            "glShaderSource")            &&
+                     loadFunction(gl.compileShader,           "glCompileShader")           &&
+                     loadFunction(gl.getShaderiv,             "glGetShaderiv")             &&
+                     loadFunction(gl.getShaderInfoLog,        "glGetShaderInfoLog")        &&
+                     loadFunction(gl.deleteShader,            "glDeleteShader")            &&
+                     loadFunction(gl.createProgram,           "glCreateProgram")           &&
+                     loadFunction(gl.attachShader,            "glAttachShader")            &&
+                     loadFunction(gl.bindAttribLocation,      "glBindAttribLocation")      &&
+                     loadFunction(gl.linkProgram,             "glLinkProgram")             &&
+                     loadFunction(gl.getProgramiv,            "glGetProgramiv")            &&
+                     loadFunction(gl.getProgramInfoLog,       "glGetProgramInfoLog")       &&
+                     loadFunction(gl.deleteProgram,           "glDeleteProgram")           &&
+                     loadFunction(gl.useProgram,              "glUseProgram")              &&
+                     loadFunction(gl.getUniformLocation,      "glGetUniformLocation")      &&
+                     loadFunction(gl.uniform1i,               "glUniform1i")               &&
+                     loadFunction(gl.uniform1f,               "glUniform1f")               &&
+                     loadFunction(gl.uniformMatrix4fv,        "glUniformMatrix4fv")        &&
+                     loadFunction(gl.activeTexture,           "glActiveTexture")           &&
+                     loadFunction(gl.blendFuncSeparate,       "glBlendFuncSeparate")       &&
+                     loadFunction(gl.blendEquationSeparate,   "glBlendEquationSeparate")   &&
+                     loadFunction(gl.drawElementsBaseVertex,  "glDrawElementsBaseVertex");
+        }
+
+        return result;
+    }
+
+    // Attribute locations of the built-in shader
+    enum
+    {
+        PositionAttribute,
+        ColorAttribute,
+        TexCoordsAttribute
+    };
+
+    // The built-in shader reproduces the fixed-function pipeline as used by
+    // sfml-graphics: transformed positions, vertex colors modulated by the texture
+    const char* vertexShaderSource =
+        "#version 150\n"
+        "uniform mat4 sf_transform;\n"
+        "uniform mat4 sf_textureMatrix;\n"
+        "in vec2 sf_position;\n"
+        "in vec4 sf_color;\n"
+        "in vec2 sf_texCoords;\n"
+        "out vec4 sf_vertexColor;\n"
+        "out vec2 sf_vertexTexCoords;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = sf_transform * vec4(sf_position, 0.0, 1.0);\n"
+        "    sf_vertexColor = sf_color;\n"
+        "    sf_vertexTexCoords = (sf_textureMatrix * vec4(sf_texCoords, 0.0, 1.0)).xy;\n"
+        "}\n";
+
+    const char* fragmentShaderSource =
+        "#version 150\n"
+        "uniform sampler2D sf_texture;\n"
+        "uniform float sf_textureEnabled;\n"
+        "in vec4 sf_vertexColor;\n"
+        "in vec2 sf_vertexTexCoords;\n"
+        "out vec4 sf_fragmentColor;\n"
+        "void main()\n"
+        "{\n"
+        "    vec4 texel = mix(vec4(1.0), texture(sf_texture, sf_vertexTexCoords), sf_textureEnabled);\n"
+        "    sf_fragmentColor = sf_vertexColor * texel;\n"
+        "}\n";
+
+    // Compile a shader stage, returns 0 on failure
+    GLuint compileShader(GLenum type, const char* source)
+    {
+        GLuint shader = gl.createShader(type);
+        glCheck(gl.shaderSource(shader, 1, &source, NULL));
+        glCheck(gl.compileShader(shader));
+
+        GLint success = GL_FALSE;
+        glCheck(gl.getShaderiv(shader, GL_COMPILE_STATUS, &success));
+        if (success == GL_FALSE)
+        {
+            char log[1024];
+            glCheck(gl.getShaderInfoLog(shader, sizeof(log), NULL, log));
+            sf::err() << "Failed to compile the built-in core profile shader:" << std::endl
+                      << log << std::endl;
+            glCheck(gl.deleteShader(shader));
+            return 0;
+        }
+
+        return shader;
+    }
+
+    // Set of all live backends, and vertex array objects of destroyed
+    // backends, grouped by context; vertex array objects are not shared
+    // between contexts, so they can only be deleted once their context
+    // is active
+    std::set<sf::priv::CoreProfileRenderer*> renderers;
+    std::map<sf::Uint64, std::vector<GLuint> > staleVertexArrays;
+
+    // Mutex to protect both the live and stale vertex array objects
+    sf::Mutex mutex;
+
+    // Delete the stale vertex array objects of the active context
+    void destroyStaleVertexArrays()
+    {
+        std::map<sf::Uint64, std::vector<GLuint> >::iterator iter = staleVertexArrays.find(sf::Context::getActiveContextId());
+
+        if (iter != staleVertexArrays.end())
+        {
+            glCheck(gl.deleteVertexArrays(static_cast<GLsizei>(iter->second.size()), &iter->second[0]));
+            staleVertexArrays.erase(iter);
+        }
+    }
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+bool CoreProfileRenderer::isRequired()
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    const GLubyte* version = glGetString(GL_VERSION);
+    if (!version)
+        return false;
+
+    // The beginning of the returned string is "major.minor" (this is standard)
+    int majorVersion = version[0] - '0';
+    int minorVersion = version[2] - '0';
+
+    // Profiles and the base vertex draws used by the backend appeared in 3.2
+    if ((majorVersion < 3) || ((majorVersion == 3) && (minorVersion < 2)))
+        return false;
+
+    GLint flags = 0;
+    glCheck(glGetIntegerv(GL_CONTEXT_FLAGS, &flags));
+    if (flags & GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT)
+        return true;
+
+    GLint profile = 0;
+    glCheck(glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &profile));
+    return (profile & GL_CONTEXT_CORE_PROFILE_BIT) != 0;
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+CoreProfileRenderer::CoreProfileRenderer() :
+m_vertexArrays          (),
+m_currentVertexArray    (NULL),
+m_program               (0),
+m_streamBuffer          (0),
+m_indexBuffer           (0),
+m_streamCapacity        (0),
+m_streamOffset          (0),
+m_quadCapacity          (0),
+m_transformLocation     (-1),
+m_textureMatrixLocation (-1),
+m_textureEnabledLocation(-1),
+m_viewTransform         (),
+m_modelTransform        (),
+m_textureMatrix         (),
+m_textureEnabled        (false),
+m_transformChanged      (true),
+m_textureChanged        (true)
+{
+    Lock lock(mutex);
+
+    // Register the context destruction callback
+    registerContextDestroyCallback(contextDestroyCallback, 0);
+
+    // Insert the backend into the set of all live backends
+    renderers.insert(this);
+}
+
+
+////////////////////////////////////////////////////////////
+CoreProfileRenderer::~CoreProfileRenderer()
+{
+    TransientContextLock contextLock;
+
+    Lock lock(mutex);
+
+    // Remove the backend from the set of all live backends
+    renderers.erase(this);
+
+    if (!m_program)
+        return;
+
+    // Buffers and programs are shared between contexts, so they can be destroyed right away
+    glCheck(gl.deleteBuffers(1, &m_streamBuffer));
+    glCheck(gl.deleteBuffers(1, &m_indexBuffer));
+    glCheck(gl.deleteProgram(m_program));
+
+    // Move our vertex array objects to the stale set, to be destroyed with their context
+    for (std::map<Uint64, VertexArrayObject>::const_iterator iter = m_vertexArrays.begin(); iter != m_vertexArrays.end(); ++iter)
+        staleVertexArrays[iter->first].push_back(iter->second.name);
+
+    // Destroy the stale vertex array objects of the active context
+    destroyStaleVertexArrays();
+}
+
+
+////////////////////////////////////////////////////////////
+bool CoreProfileRenderer::create()
+{
+    if (!loadFunctions())
+    {
+        err() << "Failed to load the OpenGL 3.2 functions required by core profile contexts" << std::endl;
+        return false;
+    }
+
+    // Compile and link the built-in shader
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexShaderSource);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
+
+    if (!vertexShader || !fragmentShader)
+    {
+        if (vertexShader)
+            glCheck(gl.deleteShader(vertexShader));
+        if (fragmentShader)
+            glCheck(gl.deleteShader(fragmentShader));
+        return false;
+    }
+
+    GLuint program = gl.createProgram();
+    glCheck(gl.attachShader(program, vertexShader));
+    glCheck(gl.attachShader(program, fragmentShader));
+    glCheck(gl.bindAttribLocation(program, PositionAttribute, "sf_position"));
+    glCheck(gl.bindAttribLocation(program, ColorAttribute, "sf_color"));
+    glCheck(gl.bindAttribLocation(program, TexCoordsAttribute, "sf_texCoords"));
+    glCheck(gl.linkProgram(program));
+
+    // The shader objects are flagged for deletion, they are released along with the program
+    glCheck(gl.deleteShader(vertexShader));
+    glCheck(gl.deleteShader(fragmentShader));
+
+    GLint success = GL_FALSE;
+    glCheck(gl.getProgramiv(program, GL_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        char log[1024];
+        glCheck(gl.getProgramInfoLog(program, sizeof(log), NULL, log));
+        err() << "Failed to link the built-in core profile shader:" << std::endl
+              << log << std::endl;
+        glCheck(gl.deleteProgram(program));
+        return false;
+    }
+
+    m_program = program;
+    m_transformLocation = gl.getUniformLocation(m_program, "sf_transform");
+    m_textureMatrixLocation = gl.getUniformLocation(m_program, "sf_textureMatrix");
+    m_textureEnabledLocation = gl.getUniformLocation(m_program, "sf_textureEnabled");
+
+    glCheck(gl.useProgram(m_program));
+    glCheck(gl.uniform1i(gl.getUniformLocation(m_program, "sf_texture"), 0));
+
+    glCheck(gl.genBuffers(1, &m_streamBuffer));
+    glCheck(gl.genBuffers(1, &m_indexBuffer));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::activate()
+{
+    Uint64 contextId = Context::getActiveContextId();
+
+    // The vertex array objects of the backend are erased when their context is destroyed,
+    // possibly in another thread
+    Lock lock(mutex);
+
+    std::map<Uint64, VertexArrayObject>::iterator iter = m_vertexArrays.find(contextId);
+
+    if (iter == m_vertexArrays.end())
+    {
+        // Vertex array objects can't be shared, create the one of this context
+        VertexArrayObject vertexArray;
+        vertexArray.attachedBuffer = 0;
+        glCheck(gl.genVertexArrays(1, &vertexArray.name));
+        glCheck(gl.bindVertexArray(vertexArray.name));
+        glCheck(gl.enableVertexAttribArray(PositionAttribute));
+        glCheck(gl.enableVertexAttribArray(ColorAttribute));
+        glCheck(gl.enableVertexAttribArray(TexCoordsAttribute));
+
+        // The index buffer binding is part of the vertex array object state
+        glCheck(gl.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+
+        iter = m_vertexArrays.insert(std::make_pair(contextId, vertexArray)).first;
+
+        // Take the opportunity to release what destroyed backends left in this context
+        destroyStaleVertexArrays();
+    }
+
+    m_currentVertexArray = &iter->second;
+
+    glCheck(gl.bindVertexArray(m_currentVertexArray->name));
+    glCheck(gl.useProgram(m_program));
+    glCheck(gl.activeTexture(GL_TEXTURE0));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::setViewTransform(const Transform& transform)
+{
+    m_viewTransform = transform;
+    m_transformChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::setModelTransform(const Transform& transform)
+{
+    if (transform == m_modelTransform)
+        return;
+
+    m_modelTransform = transform;
+    m_transformChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::setTexture(unsigned int textureId, const Transform& matrix)
+{
+    glCheck(glBindTexture(GL_TEXTURE_2D, textureId));
+
+    m_textureEnabled = (textureId != 0);
+    m_textureMatrix = matrix;
+    m_textureChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::setBlendFunc(Uint32 colorSrcFactor, Uint32 colorDstFactor, Uint32 alphaSrcFactor, Uint32 alphaDstFactor)
+{
+    glCheck(gl.blendFuncSeparate(colorSrcFactor, colorDstFactor, alphaSrcFactor, alphaDstFactor));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::setBlendEquation(Uint32 colorEquation, Uint32 alphaEquation)
+{
+    glCheck(gl.blendEquationSeparate(colorEquation, alphaEquation));
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type)
+{
+    attachBuffer(m_streamBuffer);
+
+    // When the end of the stream buffer is reached, orphan it so that the
+    // driver can hand us fresh storage instead of waiting for pending draws
+    if (m_streamOffset + vertexCount > m_streamCapacity)
+    {
+        if (vertexCount > m_streamCapacity)
+            m_streamCapacity = std::max(std::max<std::size_t>(vertexCount, 4096), m_streamCapacity * 2);
+
+        m_streamOffset = 0;
+        glCheck(gl.bufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(Vertex) * m_streamCapacity), NULL, GL_STREAM_DRAW));
+    }
+
+    glCheck(gl.bufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(sizeof(Vertex) * m_streamOffset), static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount), vertices));
+
+    drawPrimitives(type, m_streamOffset, vertexCount);
+
+    m_streamOffset += vertexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::draw(unsigned int buffer, std::size_t firstVertex, std::size_t vertexCount, PrimitiveType type)
+{
+    attachBuffer(buffer);
+    drawPrimitives(type, firstVertex, vertexCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::contextDestroyCallback(void*)
+{
+    Lock lock(mutex);
+
+    if (!gl.deleteVertexArrays)
+        return;
+
+    Uint64 contextId = Context::getActiveContextId();
+
+    // Destroy the vertex array objects that live backends created in this context
+    for (std::set<CoreProfileRenderer*>::iterator rendererIter = renderers.begin(); rendererIter != renderers.end(); ++rendererIter)
+    {
+        CoreProfileRenderer& renderer = **rendererIter;
+        std::map<Uint64, VertexArrayObject>::iterator iter = renderer.m_vertexArrays.find(contextId);
+
+        if (iter != renderer.m_vertexArrays.end())
+        {
+            // The backend must activate the context again, which creates a new vertex array object
+            if (renderer.m_currentVertexArray == &iter->second)
+                renderer.m_currentVertexArray = NULL;
+
+            glCheck(gl.deleteVertexArrays(1, &iter->second.name));
+            renderer.m_vertexArrays.erase(iter);
+        }
+    }
+
+    destroyStaleVertexArrays();
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::attachBuffer(unsigned int buffer)
+{
+    glCheck(gl.bindBuffer(GL_ARRAY_BUFFER, buffer));
+
+    // Only the stream buffer is known to outlive the vertex array objects: the name of a
+    // deleted vertex buffer can be given to a new one, while the vertex array object still
+    // points into the old storage, so the attributes of other buffers are always specified
+    if ((buffer == m_streamBuffer) && (m_currentVertexArray->attachedBuffer == buffer))
+        return;
+
+    glCheck(gl.vertexAttribPointer(PositionAttribute, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+    glCheck(gl.vertexAttribPointer(ColorAttribute, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+    glCheck(gl.vertexAttribPointer(TexCoordsAttribute, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+    m_currentVertexArray->attachedBuffer = buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void CoreProfileRenderer::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
+{
+    // Upload the uniforms that changed since the last draw
+    if (m_transformChanged)
+    {
+        Transform transform = m_viewTransform * m_modelTransform;
+        glCheck(gl.uniformMatrix4fv(m_transformLocation, 1, GL_FALSE, transform.getMatrix()));
+        m_transformChanged = false;
+    }
+
+    if (m_textureChanged)
+    {
+        glCheck(gl.uniformMatrix4fv(m_textureMatrixLocation, 1, GL_FALSE, m_textureMatrix.getMatrix()));
+        glCheck(gl.uniform1f(m_textureEnabledLocation, m_textureEnabled ? 1.f : 0.f));
+        m_textureChanged = false;
+    }
+
+    if (type == Quads)
+    {
+        // Quads were removed from core profiles, draw each one as two triangles
+        std::size_t quadCount = vertexCount / 4;
+
+        if (quadCount > m_quadCapacity)
+        {
+            m_quadCapacity = std::max(quadCount, m_quadCapacity * 2);
+
+            std::vector<GLuint> indices(m_quadCapacity * 6);
+            for (std::size_t i = 0; i < m_quadCapacity; ++i)
+            {
+                GLuint first = static_cast<GLuint>(i * 4);
+                indices[i * 6 + 0] = first + 0;
+                indices[i * 6 + 1] = first + 1;
+                indices[i * 6 + 2] = first + 2;
+                indices[i * 6 + 3] = first + 0;
+                indices[i * 6 + 4] = first + 2;
+                indices[i * 6 + 5] = first + 3;
+            }
+
+            // The index buffer is bound to the vertex array object of every context
+            glCheck(gl.bufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(GLuint) * indices.size()), &indices[0], GL_STATIC_DRAW));
+        }
+
+        glCheck(gl.drawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(quadCount * 6), GL_UNSIGNED_INT, NULL, static_cast<GLint>(firstVertex)));
+    }
+    else
+    {
+        static const GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES,
+                                       GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+
+        glCheck(glDrawArrays(modes[type], static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+    }
+}
+
+} // namespace priv
+
+} // namespace sf
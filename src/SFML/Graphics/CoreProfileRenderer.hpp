@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_COREPROFILERENDERER_HPP
+#define SFML_COREPROFILERENDERER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Window/GlResource.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <map>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Rendering backend of sf::RenderTarget for core
+///        profile contexts
+///
+/// Core profile contexts don't provide the fixed-function
+/// pipeline, so vertices are streamed into a vertex buffer
+/// and drawn through a vertex array object with a built-in
+/// shader that applies the transforms passed as uniforms.
+///
+////////////////////////////////////////////////////////////
+class CoreProfileRenderer : GlResource, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Vertex array object of a context
+    ///
+    ////////////////////////////////////////////////////////////
+    struct VertexArrayObject
+    {
+        unsigned int name;           //!< OpenGL identifier of the vertex array object
+        unsigned int attachedBuffer; //!< Vertex buffer the attributes were last pointed into
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the active context requires this backend
+    ///
+    /// \return True if the active context is a core profile or a
+    ///         forward-compatible context of version 3.2 or above
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isRequired();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    CoreProfileRenderer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~CoreProfileRenderer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the shader and the buffers of the backend
+    ///
+    /// A context must be active when calling this function.
+    ///
+    /// \return True if creation has been successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the shader and vertex array object of the backend
+    ///
+    /// This function must be called whenever another user of
+    /// the active context may have changed its bindings. The
+    /// vertex array object of the active context is created
+    /// the first time the backend is activated in it.
+    ///
+    ////////////////////////////////////////////////////////////
+    void activate();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the transform of the current view
+    ///
+    /// \param transform Projection transform of the view
+    ///
+    ////////////////////////////////////////////////////////////
+    void setViewTransform(const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the transform applied to the next draws
+    ///
+    /// \param transform Model transform
+    ///
+    ////////////////////////////////////////////////////////////
+    void setModelTransform(const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a texture for the next draws
+    ///
+    /// \param textureId OpenGL identifier of the texture, or 0 to draw without texture
+    /// \param matrix    Transform from pixel to normalized texture coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(unsigned int textureId, const Transform& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the blending factors
+    ///
+    /// \param colorSrcFactor Source blending factor for the color channels
+    /// \param colorDstFactor Destination blending factor for the color channels
+    /// \param alphaSrcFactor Source blending factor for the alpha channel
+    /// \param alphaDstFactor Destination blending factor for the alpha channel
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBlendFunc(Uint32 colorSrcFactor, Uint32 colorDstFactor, Uint32 alphaSrcFactor, Uint32 alphaDstFactor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the blending equations
+    ///
+    /// \param colorEquation Blending equation for the color channels
+    /// \param alphaEquation Blending equation for the alpha channel
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBlendEquation(Uint32 colorEquation, Uint32 alphaEquation);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stream an array of vertices and draw them
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a range of a vertex buffer
+    ///
+    /// \param buffer      OpenGL identifier of the vertex buffer
+    /// \param firstVertex Index of the first vertex to draw
+    /// \param vertexCount Number of vertices to draw
+    /// \param type        Type of primitives to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(unsigned int buffer, std::size_t firstVertex, std::size_t vertexCount, PrimitiveType type);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the vertex array objects of the active context
+    ///
+    /// This function is called every time a context is
+    /// destroyed, for all the live backends.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void contextDestroyCallback(void*);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Point the vertex attributes into a vertex buffer
+    ///
+    /// The attributes are only specified again for the stream
+    /// buffer if the vertex array object doesn't already point
+    /// into it.
+    ///
+    /// \param buffer OpenGL identifier of the vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void attachBuffer(unsigned int buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the changed uniforms and draw the primitives
+    ///
+    /// \param type        Type of primitives to draw
+    /// \param firstVertex Index of the first vertex to draw
+    /// \param vertexCount Number of vertices to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::map<Uint64, VertexArrayObject> m_vertexArrays;           //!< Vertex array objects per context
+    VertexArrayObject*                  m_currentVertexArray;     //!< Vertex array object of the active context
+    unsigned int                        m_program;                //!< Built-in shader program
+    unsigned int                        m_streamBuffer;           //!< Vertex buffer that vertex arrays are streamed into
+    unsigned int                        m_indexBuffer;            //!< Index buffer splitting quads into triangles
+    std::size_t                         m_streamCapacity;         //!< Size of the stream buffer, in vertices
+    std::size_t                         m_streamOffset;           //!< Index of the first free vertex of the stream buffer
+    std::size_t                         m_quadCapacity;           //!< Number of quads covered by the index buffer
+    int                                 m_transformLocation;      //!< Location of the combined view and model transform uniform
+    int                                 m_textureMatrixLocation;  //!< Location of the texture matrix uniform
+    int                                 m_textureEnabledLocation; //!< Location of the uniform that enables texturing
+    Transform                           m_viewTransform;          //!< Transform of the current view
+    Transform                           m_modelTransform;         //!< Transform of the next draws
+    Transform                           m_textureMatrix;          //!< Texture matrix of the bound texture
+    bool                                m_textureEnabled;         //!< Is a texture bound?
+    bool                                m_transformChanged;       //!< Must the transform uniform be uploaded?
+    bool                                m_textureChanged;         //!< Must the texture uniforms be uploaded?
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_COREPROFILERENDERER_HPP
@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/DrawQueue.hpp>
+#include <algorithm>
+#include <functional>
+
+
+namespace
+{
+    // Strict weak ordering of blend modes, used to group draws that share one
+    bool lessThan(const sf::BlendMode& left, const sf::BlendMode& right)
+    {
+        if (left.colorSrcFactor != right.colorSrcFactor) return left.colorSrcFactor < right.colorSrcFactor;
+        if (left.colorDstFactor != right.colorDstFactor) return left.colorDstFactor < right.colorDstFactor;
+        if (left.colorEquation  != right.colorEquation)  return left.colorEquation  < right.colorEquation;
+        if (left.alphaSrcFactor != right.alphaSrcFactor) return left.alphaSrcFactor < right.alphaSrcFactor;
+        if (left.alphaDstFactor != right.alphaDstFactor) return left.alphaDstFactor < right.alphaDstFactor;
+        return left.alphaEquation < right.alphaEquation;
+    }
+
+    // Strict weak ordering of stencil modes, used to group draws that share one
+    bool lessThan(const sf::StencilMode& left, const sf::StencilMode& right)
+    {
+        if (left.stencilComparison      != right.stencilComparison)      return left.stencilComparison      < right.stencilComparison;
+        if (left.stencilUpdateOperation != right.stencilUpdateOperation) return left.stencilUpdateOperation < right.stencilUpdateOperation;
+        if (left.stencilReference       != right.stencilReference)       return left.stencilReference       < right.stencilReference;
+        if (left.stencilMask            != right.stencilMask)            return left.stencilMask            < right.stencilMask;
+        return left.stencilOnly < right.stencilOnly;
+    }
+
+    // Key giving the execution order of a queued draw
+    struct SortKey
+    {
+        int                layer;
+        bool               unordered;
+        const sf::Shader*  shader;
+        const sf::Texture* texture;
+        sf::BlendMode      blendMode;
+        sf::StencilMode    stencilMode;
+        sf::PrimitiveType  primitiveType;
+        std::size_t        command;
+
+        bool operator <(const SortKey& right) const
+        {
+            // Layers first
+            if (layer != right.layer)
+                return layer < right.layer;
+
+            // Then unordered draws before ordered ones
+            if (unordered != right.unordered)
+                return unordered;
+
+            // Unordered draws are grouped by render states
+            if (unordered)
+            {
+                if (shader != right.shader)
+                    return std::less<const sf::Shader*>()(shader, right.shader);
+
+                if (texture != right.texture)
+                    return std::less<const sf::Texture*>()(texture, right.texture);
+
+                if (blendMode != right.blendMode)
+                    return lessThan(blendMode, right.blendMode);
+
+                if (stencilMode != right.stencilMode)
+                    return lessThan(stencilMode, right.stencilMode);
+
+                if (primitiveType != right.primitiveType)
+                    return primitiveType < right.primitiveType;
+            }
+
+            // Finally, submission order
+            return command < right.command;
+        }
+    };
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+DrawQueue::DrawQueue() :
+m_recorded       (),
+m_entries        (),
+m_sorted         (),
+m_sortedTransform(),
+m_needUpdate     (false)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawQueue::add(const Drawable& drawable, int layer, const RenderStates& states, Ordering ordering)
+{
+    std::size_t first = m_recorded.m_commands.size();
+
+    // Draws from different calls must not be merged while recording, since they may end up in different places
+    m_recorded.m_mergeBarrier = first;
+    m_recorded.draw(drawable, states);
+
+    addEntries(first, layer, ordering);
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawQueue::add(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, int layer,
+                    const RenderStates& states, Ordering ordering)
+{
+    std::size_t first = m_recorded.m_commands.size();
+
+    m_recorded.m_mergeBarrier = first;
+    m_recorded.draw(vertices, vertexCount, type, states);
+
+    addEntries(first, layer, ordering);
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawQueue::clear()
+{
+    m_recorded.reset();
+    m_entries.clear();
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t DrawQueue::getDrawCount() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t DrawQueue::getDrawCallCount() const
+{
+    if (m_needUpdate)
+        update(m_sortedTransform);
+
+    return m_sorted.getCommandCount();
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawQueue::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_needUpdate || (states.transform != m_sortedTransform))
+        update(states.transform);
+
+    target.submit(m_sorted);
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawQueue::addEntries(std::size_t first, int layer, Ordering ordering)
+{
+    const std::vector<CommandList::Command>& commands = m_recorded.m_commands;
+
+    // A drawable may issue several draws, each of them gets its own entry; they are all
+    // sorted with the states of the first one so that they are kept together and in order
+    std::size_t group = commands.size();
+    for (std::size_t i = first; i < commands.size(); ++i)
+    {
+        // Only draws are queued, drawables aren't supposed to clear or change the view
+        if ((commands[i].type != CommandList::DrawVertices) && (commands[i].type != CommandList::DrawVertexBuffer))
+            continue;
+
+        if (group == commands.size())
+            group = i;
+
+        Entry entry;
+        entry.layer = layer;
+        entry.ordering = ordering;
+        entry.command = i;
+        entry.group = group;
+        m_entries.push_back(entry);
+    }
+
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void DrawQueue::update(const Transform& transform) const
+{
+    const std::vector<CommandList::Command>& commands = m_recorded.m_commands;
+
+    // Gather the sort keys of the entries
+    std::vector<SortKey> keys(m_entries.size());
+    for (std::size_t i = 0; i < m_entries.size(); ++i)
+    {
+        const Entry& entry = m_entries[i];
+        const CommandList::Command& command = commands[entry.group];
+
+        keys[i].layer = entry.layer;
+        keys[i].unordered = (entry.ordering == Unordered);
+        keys[i].shader = command.states.shader;
+        keys[i].texture = command.states.texture;
+        keys[i].blendMode = command.states.blendMode;
+        keys[i].stencilMode = command.states.stencilMode;
+        keys[i].primitiveType = command.primitiveType;
+        keys[i].command = entry.command;
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    // Replay the draws in their new order, the sorted list merges those that share the same states
+    m_sorted.reset();
+
+    for (std::vector<SortKey>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+    {
+        const CommandList::Command& command = commands[it->command];
+
+        RenderStates states = command.states;
+        states.transform = transform * states.transform;
+
+        if (command.type == CommandList::DrawVertices)
+            m_sorted.draw(&m_recorded.m_vertices[command.first], command.count, command.primitiveType, states);
+        else
+            m_sorted.draw(*command.vertexBuffer, command.first, command.count, states);
+    }
+
+    m_sortedTransform = transform;
+    m_needUpdate = false;
+}
+
+} // namespace sf
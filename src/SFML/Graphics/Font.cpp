@@ -83,13 +83,14 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 Font::Font() :
-m_library  (NULL),
-m_face     (NULL),
-m_streamRec(NULL),
-m_stroker  (NULL),
-m_refCount (NULL),
-m_isSmooth (true),
-m_info     ()
+m_library           (NULL),
+m_face              (NULL),
+m_streamRec         (NULL),
+m_stroker           (NULL),
+m_refCount          (NULL),
+m_isSmooth          (true),
+m_premultipliedAlpha(false),
+m_info              ()
 {
     #ifdef SFML_SYSTEM_ANDROID
         m_stream = NULL;
@@ -99,15 +100,16 @@ m_info     ()
 
 ////////////////////////////////////////////////////////////
 Font::Font(const Font& copy) :
-m_library    (copy.m_library),
-m_face       (copy.m_face),
-m_streamRec  (copy.m_streamRec),
-m_stroker    (copy.m_stroker),
-m_refCount   (copy.m_refCount),
-m_info       (copy.m_info),
-m_pages      (copy.m_pages),
-m_pixelBuffer(copy.m_pixelBuffer),
-m_isSmooth   (copy.m_isSmooth)
+m_library           (copy.m_library),
+m_face              (copy.m_face),
+m_streamRec         (copy.m_streamRec),
+m_stroker           (copy.m_stroker),
+m_refCount          (copy.m_refCount),
+m_info              (copy.m_info),
+m_pages             (copy.m_pages),
+m_pixelBuffer       (copy.m_pixelBuffer),
+m_isSmooth          (copy.m_isSmooth),
+m_premultipliedAlpha(copy.m_premultipliedAlpha)
 {
     #ifdef SFML_SYSTEM_ANDROID
         m_stream = NULL;
@@ -346,7 +348,7 @@ const Font::Info& Font::getInfo() const
 const Glyph& Font::getGlyph(Uint32 codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
     // Get the page corresponding to the character size
-    GlyphTable& glyphs = m_pages[characterSize].glyphs;
+    GlyphTable& glyphs = loadPage(characterSize).glyphs;
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
     Uint64 key = combine(outlineThickness, bold, FT_Get_Char_Index(static_cast<FT_Face>(m_face), codePoint));
@@ -467,7 +469,7 @@ float Font::getUnderlineThickness(unsigned int characterSize) const
 ////////////////////////////////////////////////////////////
 const Texture& Font::getTexture(unsigned int characterSize) const
 {
-    return m_pages[characterSize].texture;
+    return loadPage(characterSize).texture;
 }
 
 ////////////////////////////////////////////////////////////
@@ -491,20 +493,41 @@ bool Font::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::setPremultipliedAlpha(bool premultiplied)
+{
+    if (premultiplied != m_premultipliedAlpha)
+    {
+        m_premultipliedAlpha = premultiplied;
+
+        // The pixels of the loaded glyphs can't be converted back, they will be rendered again
+        m_pages.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isPremultipliedAlpha() const
+{
+    return m_premultipliedAlpha;
+}
+
+
 ////////////////////////////////////////////////////////////
 Font& Font::operator =(const Font& right)
 {
     Font temp(right);
 
-    std::swap(m_library,     temp.m_library);
-    std::swap(m_face,        temp.m_face);
-    std::swap(m_streamRec,   temp.m_streamRec);
-    std::swap(m_stroker,     temp.m_stroker);
-    std::swap(m_refCount,    temp.m_refCount);
-    std::swap(m_info,        temp.m_info);
-    std::swap(m_pages,       temp.m_pages);
-    std::swap(m_pixelBuffer, temp.m_pixelBuffer);
-    std::swap(m_isSmooth,    temp.m_isSmooth);
+    std::swap(m_library,            temp.m_library);
+    std::swap(m_face,               temp.m_face);
+    std::swap(m_streamRec,          temp.m_streamRec);
+    std::swap(m_stroker,            temp.m_stroker);
+    std::swap(m_refCount,           temp.m_refCount);
+    std::swap(m_info,               temp.m_info);
+    std::swap(m_pages,              temp.m_pages);
+    std::swap(m_pixelBuffer,        temp.m_pixelBuffer);
+    std::swap(m_isSmooth,           temp.m_isSmooth);
+    std::swap(m_premultipliedAlpha, temp.m_premultipliedAlpha);
 
     #ifdef SFML_SYSTEM_ANDROID
         std::swap(m_stream, temp.m_stream);
@@ -558,6 +581,36 @@ void Font::cleanup()
 }
 
 
+////////////////////////////////////////////////////////////
+Font::Page& Font::loadPage(unsigned int characterSize) const
+{
+    PageTable::iterator it = m_pages.find(characterSize);
+
+    if (it != m_pages.end())
+        return it->second;
+
+    // Insert an empty page and initialize its texture in place, so that it is never copied
+    Page& page = m_pages[characterSize];
+
+    // Make sure that the texture is initialized by default
+    sf::Image image;
+    image.create(128, 128, Color(255, 255, 255, 0));
+
+    // Reserve a 2x2 white square for texturing underlines
+    for (int x = 0; x < 2; ++x)
+        for (int y = 0; y < 2; ++y)
+            image.setPixel(x, y, Color(255, 255, 255, 255));
+
+    // Create the texture; with premultiplied alpha, the transparent
+    // white background is converted to transparent black
+    page.texture.setPremultipliedAlpha(m_premultipliedAlpha);
+    page.texture.loadFromImage(image);
+    page.texture.setSmooth(m_isSmooth);
+
+    return page;
+}
+
+
 ////////////////////////////////////////////////////////////
 Glyph Font::loadGlyph(Uint32 codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
@@ -637,7 +690,7 @@ Glyph Font::loadGlyph(Uint32 codePoint, unsigned int characterSize, bool bold, f
         height += 2 * padding;
 
         // Get the glyphs page corresponding to the character size
-        Page& page = m_pages[characterSize];
+        Page& page = loadPage(characterSize);
 
 		// In case the page was newly created, update its smoothness status
 		page.texture.setSmooth(m_isSmooth);
@@ -761,6 +814,7 @@ IntRect Font::findGlyphRect(Page& page, unsigned int width, unsigned int height)
                 Texture newTexture;
                 newTexture.create(textureWidth * 2, textureHeight * 2);
                 newTexture.setSmooth(m_isSmooth);
+                newTexture.setPremultipliedAlpha(m_premultipliedAlpha);
                 newTexture.update(page.texture);
                 page.texture.swap(newTexture);
             }
@@ -833,18 +887,6 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 Font::Page::Page() :
 nextRow(3)
 {
-    // Make sure that the texture is initialized by default
-    sf::Image image;
-    image.create(128, 128, Color(255, 255, 255, 0));
-
-    // Reserve a 2x2 white square for texturing underlines
-    for (int x = 0; x < 2; ++x)
-        for (int y = 0; y < 2; ++y)
-            image.setPixel(x, y, Color(255, 255, 255, 255));
-
-    // Create the texture
-    texture.loadFromImage(image);
-    texture.setSmooth(true);
 }
 
 } // namespace sf
@@ -43,6 +43,10 @@ namespace sf
 {
 namespace priv
 {
+////////////////////////////////////////////////////////////
+Uint32 extensionFlags = 0;
+
+
 ////////////////////////////////////////////////////////////
 void ensureExtensionsInit()
 {
@@ -88,6 +92,15 @@ void ensureExtensionsInit()
             err() << "sfml-graphics requires support for OpenGL 1.1 or greater" << std::endl;
             err() << "Ensure that hardware acceleration is enabled if available" << std::endl;
         }
+
+#ifndef SFML_OPENGL_ES
+        // Edge clamping is core since 1.2, but core profiles don't advertise the extension
+        if ((majorVersion > 1) || ((majorVersion == 1) && (minorVersion >= 2)))
+            SF_GLAD_GL_SGIS_texture_edge_clamp = 1;
+
+        if (sf::Context::isExtensionAvailable("GL_ARB_point_sprite"))
+            extensionFlags |= ExtensionPointSprite;
+#endif
     }
 }
 
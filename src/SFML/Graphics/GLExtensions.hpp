@@ -140,6 +140,9 @@
     #define GLEXT_texture_sRGB                        false
     #define GLEXT_GL_SRGB8_ALPHA8                     0
 
+    // Not supported - ARB_point_sprite
+    #define GLEXT_point_sprite                        false
+
 #else
 
     // SFML requires at a bare minimum OpenGL 1.1 capability
@@ -302,12 +305,31 @@
     #define GLEXT_geometry_shader4                    SF_GLAD_GL_ARB_geometry_shader4
     #define GLEXT_GL_GEOMETRY_SHADER                  GL_GEOMETRY_SHADER_ARB
 
+    // Extensions our loader doesn't know about are checked once, and stored as flags
+    #define GLEXT_point_sprite                        ((sf::priv::extensionFlags & sf::priv::ExtensionPointSprite) != 0)
+
 #endif
 
 namespace sf
 {
 namespace priv
 {
+////////////////////////////////////////////////////////////
+/// \brief Extensions that are not handled by the OpenGL loader
+///
+////////////////////////////////////////////////////////////
+enum ExtensionFlag
+{
+    ExtensionPointSprite = 1 << 0 //!< ARB_point_sprite
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Combination of the available ExtensionFlag values
+///
+/// Only valid after ensureExtensionsInit was called.
+///
+////////////////////////////////////////////////////////////
+extern Uint32 extensionFlags;
 
 ////////////////////////////////////////////////////////////
 /// \brief Make sure that extensions are initialized
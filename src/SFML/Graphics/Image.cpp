@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/ImageLoader.hpp>
+#include <SFML/Graphics/SIMD.hpp>
 #include <SFML/System/Err.hpp>
 #ifdef SFML_SYSTEM_ANDROID
     #include <SFML/System/Android/ResourceStream.hpp>
@@ -35,6 +36,46 @@
 #include <cstring>
 
 
+namespace
+{
+    // Multiply a color component by an alpha value, rounding the result to the nearest integer;
+    // (x + (x >> 8)) >> 8 is an exact replacement for the division by 255 in this range
+    sf::Uint8 multiplyByAlpha(unsigned int component, unsigned int alpha)
+    {
+        unsigned int product = component * alpha + 128;
+        return static_cast<sf::Uint8>((product + (product >> 8)) >> 8);
+    }
+
+#if defined(SFML_SIMD_SSE2)
+
+    // Multiply the color components of two pixels whose channels have been widened to 16 bits;
+    // the alpha channel is multiplied by 255 so that it is left unchanged
+    __m128i multiplyByAlpha(__m128i channels)
+    {
+        const __m128i alphaMask = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+        const __m128i alphaOne  = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+        const __m128i half      = _mm_set1_epi16(128);
+
+        __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(channels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        alpha = _mm_or_si128(_mm_andnot_si128(alphaMask, alpha), alphaOne);
+
+        __m128i product = _mm_add_epi16(_mm_mullo_epi16(channels, alpha), half);
+        return _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+    }
+
+#elif defined(SFML_SIMD_NEON)
+
+    // Multiply eight color components by their alpha values
+    uint8x8_t multiplyByAlpha(uint8x8_t components, uint8x8_t alpha)
+    {
+        uint16x8_t product = vmull_u8(components, alpha);
+        return vrshrn_n_u16(vrsraq_n_u16(product, product, 8), 8);
+    }
+
+#endif
+}
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -180,6 +221,58 @@ void Image::createMaskFromColor(const Color& color, Uint8 alpha)
 }
 
 
+////////////////////////////////////////////////////////////
+void Image::premultiplyAlpha()
+{
+    if (m_pixels.empty())
+        return;
+
+    Uint8* pixels = &m_pixels[0];
+    std::size_t count = m_pixels.size() / 4;
+    std::size_t i = 0;
+
+#if defined(SFML_SIMD_SSE2)
+
+    // Four pixels are converted at once, their channels being widened to 16 bits
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i* block = reinterpret_cast<__m128i*>(pixels + i * 4);
+        __m128i value = _mm_loadu_si128(block);
+
+        __m128i low  = multiplyByAlpha(_mm_unpacklo_epi8(value, zero));
+        __m128i high = multiplyByAlpha(_mm_unpackhi_epi8(value, zero));
+
+        _mm_storeu_si128(block, _mm_packus_epi16(low, high));
+    }
+
+#elif defined(SFML_SIMD_NEON)
+
+    // Eight pixels are converted at once, loaded as separate channels
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t value = vld4_u8(pixels + i * 4);
+
+        value.val[0] = multiplyByAlpha(value.val[0], value.val[3]);
+        value.val[1] = multiplyByAlpha(value.val[1], value.val[3]);
+        value.val[2] = multiplyByAlpha(value.val[2], value.val[3]);
+
+        vst4_u8(pixels + i * 4, value);
+    }
+
+#endif
+
+    for (; i < count; ++i)
+    {
+        Uint8* pixel = pixels + i * 4;
+        pixel[0] = multiplyByAlpha(pixel[0], pixel[3]);
+        pixel[1] = multiplyByAlpha(pixel[1], pixel[3]);
+        pixel[2] = multiplyByAlpha(pixel[2], pixel[3]);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Image::copy(const Image& source, unsigned int destX, unsigned int destY, const IntRect& sourceRect, bool applyAlpha)
 {
@@ -0,0 +1,500 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ParticleSystem.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/CoreProfileRenderer.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <cassert>
+
+
+namespace
+{
+    // Tokens of the GL_ARB_point_sprite extension, which isn't part of the loader
+    const GLenum pointSpriteArb  = 0x8861;
+    const GLenum coordReplaceArb = 0x8862;
+
+    // Remove the elements whose index isn't flagged as alive, keeping the others in order
+    template <typename T>
+    void compact(std::vector<T>& values, const std::vector<bool>& alive, std::size_t first)
+    {
+        std::size_t destination = first;
+        for (std::size_t i = first; i < values.size(); ++i)
+        {
+            if (alive[i])
+                values[destination++] = values[i];
+        }
+
+        values.resize(destination);
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem() :
+m_positionsX  (),
+m_positionsY  (),
+m_velocitiesX (),
+m_velocitiesY (),
+m_remaining   (),
+m_lifetimes   (),
+m_colors      (),
+m_acceleration(0.f, 0.f),
+m_particleSize(1.f),
+m_renderMode  (PointSprites),
+m_texture     (NULL),
+m_fadeOut     (false),
+m_vertices    (),
+m_buffer      (NULL),
+m_needUpdate  (false)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem(const ParticleSystem& copy) :
+Drawable      (copy),
+Transformable (copy),
+m_positionsX  (copy.m_positionsX),
+m_positionsY  (copy.m_positionsY),
+m_velocitiesX (copy.m_velocitiesX),
+m_velocitiesY (copy.m_velocitiesY),
+m_remaining   (copy.m_remaining),
+m_lifetimes   (copy.m_lifetimes),
+m_colors      (copy.m_colors),
+m_acceleration(copy.m_acceleration),
+m_particleSize(copy.m_particleSize),
+m_renderMode  (copy.m_renderMode),
+m_texture     (copy.m_texture),
+m_fadeOut     (copy.m_fadeOut),
+m_vertices    (),
+m_buffer      (NULL),
+m_needUpdate  (true)
+{
+    // The vertex buffer is not shared, the copy creates its own when it is drawn
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::~ParticleSystem()
+{
+    delete m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem& ParticleSystem::operator =(const ParticleSystem& right)
+{
+    if (this != &right)
+    {
+        Transformable::operator =(right);
+
+        m_positionsX   = right.m_positionsX;
+        m_positionsY   = right.m_positionsY;
+        m_velocitiesX  = right.m_velocitiesX;
+        m_velocitiesY  = right.m_velocitiesY;
+        m_remaining    = right.m_remaining;
+        m_lifetimes    = right.m_lifetimes;
+        m_colors       = right.m_colors;
+        m_acceleration = right.m_acceleration;
+        m_particleSize = right.m_particleSize;
+        m_texture      = right.m_texture;
+        m_fadeOut      = right.m_fadeOut;
+        m_needUpdate   = true;
+
+        setRenderMode(right.m_renderMode);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::emit(const Vector2f& position, const Vector2f& velocity, const Color& color, Time lifetime)
+{
+    float seconds = lifetime.asSeconds();
+    if (seconds <= 0.f)
+        return;
+
+    m_positionsX.push_back(position.x);
+    m_positionsY.push_back(position.y);
+    m_velocitiesX.push_back(velocity.x);
+    m_velocitiesY.push_back(velocity.y);
+    m_remaining.push_back(seconds);
+    m_lifetimes.push_back(seconds);
+    m_colors.push_back(color);
+
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::update(Time elapsed)
+{
+    std::size_t count = m_positionsX.size();
+    if (!count)
+        return;
+
+    float dt = elapsed.asSeconds();
+    float deltaX = m_acceleration.x * dt;
+    float deltaY = m_acceleration.y * dt;
+
+    // Each attribute lives in its own array, so that these loops
+    // only touch contiguous floats and can be vectorized
+    float* positionsX = &m_positionsX[0];
+    float* positionsY = &m_positionsY[0];
+    float* velocitiesX = &m_velocitiesX[0];
+    float* velocitiesY = &m_velocitiesY[0];
+    float* remaining = &m_remaining[0];
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        velocitiesX[i] += deltaX;
+        positionsX[i] += velocitiesX[i] * dt;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        velocitiesY[i] += deltaY;
+        positionsY[i] += velocitiesY[i] * dt;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+        remaining[i] -= dt;
+
+    // Remove the dead particles, if any
+    std::size_t firstDead = 0;
+    while ((firstDead < count) && (remaining[firstDead] > 0.f))
+        ++firstDead;
+
+    if (firstDead < count)
+    {
+        std::vector<bool> alive(count);
+        for (std::size_t i = firstDead; i < count; ++i)
+            alive[i] = remaining[i] > 0.f;
+
+        compact(m_positionsX, alive, firstDead);
+        compact(m_positionsY, alive, firstDead);
+        compact(m_velocitiesX, alive, firstDead);
+        compact(m_velocitiesY, alive, firstDead);
+        compact(m_remaining, alive, firstDead);
+        compact(m_lifetimes, alive, firstDead);
+        compact(m_colors, alive, firstDead);
+    }
+
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::clear()
+{
+    m_positionsX.clear();
+    m_positionsY.clear();
+    m_velocitiesX.clear();
+    m_velocitiesY.clear();
+    m_remaining.clear();
+    m_lifetimes.clear();
+    m_colors.clear();
+
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::reserve(std::size_t count)
+{
+    m_positionsX.reserve(count);
+    m_positionsY.reserve(count);
+    m_velocitiesX.reserve(count);
+    m_velocitiesY.reserve(count);
+    m_remaining.reserve(count);
+    m_lifetimes.reserve(count);
+    m_colors.reserve(count);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getParticleCount() const
+{
+    return m_positionsX.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ParticleSystem::getParticlePosition(std::size_t index) const
+{
+    assert(index < m_positionsX.size());
+
+    return Vector2f(m_positionsX[index], m_positionsY[index]);
+}
+
+
+////////////////////////////////////////////////////////////
+Time ParticleSystem::getParticleLifetime(std::size_t index) const
+{
+    assert(index < m_remaining.size());
+
+    return seconds(m_remaining[index]);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setAcceleration(const Vector2f& acceleration)
+{
+    m_acceleration = acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f& ParticleSystem::getAcceleration() const
+{
+    return m_acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setParticleSize(float size)
+{
+    m_particleSize = size;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+float ParticleSystem::getParticleSize() const
+{
+    return m_particleSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setRenderMode(RenderMode mode)
+{
+    if (mode != m_renderMode)
+    {
+        m_renderMode = mode;
+        m_needUpdate = true;
+
+        if (m_buffer)
+            m_buffer->setPrimitiveType(mode == PointSprites ? Points : Triangles);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::RenderMode ParticleSystem::getRenderMode() const
+{
+    return m_renderMode;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTexture(const Texture* texture)
+{
+    m_texture = texture;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* ParticleSystem::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setFadeOut(bool fadeOut)
+{
+    m_fadeOut = fadeOut;
+    m_needUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ParticleSystem::isFadingOut() const
+{
+    return m_fadeOut;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_positionsX.empty())
+        return;
+
+    updateVertices();
+
+    states.transform *= getTransform();
+    states.texture = m_texture;
+
+    PrimitiveType type = (m_renderMode == PointSprites) ? Points : Triangles;
+
+    // The point size and point sprites are OpenGL states that the render target
+    // doesn't manage, so they are set directly in the context of the target
+    bool pointStates = (m_renderMode == PointSprites) && target.setActive(true);
+    bool pointSprites = false;
+
+    if (pointStates)
+    {
+        glCheck(glPointSize(m_particleSize));
+
+#ifndef SFML_OPENGL_ES
+
+        // Point sprites are part of the fixed-function pipeline, which core profile contexts don't have
+        if (m_texture && GLEXT_point_sprite && !priv::CoreProfileRenderer::isRequired())
+        {
+            glCheck(glEnable(pointSpriteArb));
+            glCheck(glTexEnvi(pointSpriteArb, coordReplaceArb, GL_TRUE));
+            pointSprites = true;
+        }
+
+#endif
+    }
+
+    // Without point sprites, every fragment of a point would sample the same texel
+    if ((m_renderMode == PointSprites) && !pointSprites)
+        states.texture = NULL;
+
+    if (m_buffer && m_buffer->getNativeHandle() && (m_buffer->getVertexCount() >= m_vertices.size()))
+        target.draw(*m_buffer, 0, m_vertices.size(), states);
+    else
+        target.draw(&m_vertices[0], m_vertices.size(), type, states);
+
+    if (pointStates)
+    {
+        glCheck(glPointSize(1.f));
+
+#ifndef SFML_OPENGL_ES
+
+        if (pointSprites)
+        {
+            glCheck(glTexEnvi(pointSpriteArb, coordReplaceArb, GL_FALSE));
+            glCheck(glDisable(pointSpriteArb));
+        }
+
+#endif
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::updateVertices() const
+{
+    if (!m_needUpdate)
+        return;
+
+    m_needUpdate = false;
+
+    std::size_t count = m_positionsX.size();
+
+    if (m_renderMode == PointSprites)
+    {
+        m_vertices.resize(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Vertex& vertex = m_vertices[i];
+            vertex.position = Vector2f(m_positionsX[i], m_positionsY[i]);
+            vertex.color = m_colors[i];
+            vertex.texCoords = Vector2f(0.f, 0.f);
+        }
+    }
+    else
+    {
+        m_vertices.resize(count * 6);
+
+        float half = m_particleSize / 2.f;
+        Vector2f textureSize = m_texture ? Vector2f(m_texture->getSize()) : Vector2f(0.f, 0.f);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float left   = m_positionsX[i] - half;
+            float top    = m_positionsY[i] - half;
+            float right  = m_positionsX[i] + half;
+            float bottom = m_positionsY[i] + half;
+
+            Vertex* quad = &m_vertices[i * 6];
+
+            quad[0].position = Vector2f(left, top);
+            quad[1].position = Vector2f(right, top);
+            quad[2].position = Vector2f(left, bottom);
+            quad[3].position = Vector2f(left, bottom);
+            quad[4].position = Vector2f(right, top);
+            quad[5].position = Vector2f(right, bottom);
+
+            quad[0].texCoords = Vector2f(0.f, 0.f);
+            quad[1].texCoords = Vector2f(textureSize.x, 0.f);
+            quad[2].texCoords = Vector2f(0.f, textureSize.y);
+            quad[3].texCoords = Vector2f(0.f, textureSize.y);
+            quad[4].texCoords = Vector2f(textureSize.x, 0.f);
+            quad[5].texCoords = textureSize;
+
+            for (int j = 0; j < 6; ++j)
+                quad[j].color = m_colors[i];
+        }
+    }
+
+    // Apply the fade out to the alpha of the vertices
+    if (m_fadeOut)
+    {
+        std::size_t verticesPerParticle = (m_renderMode == PointSprites) ? 1 : 6;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float ratio = m_remaining[i] / m_lifetimes[i];
+            Uint8 alpha = static_cast<Uint8>(m_colors[i].a * ratio);
+
+            for (std::size_t j = 0; j < verticesPerParticle; ++j)
+                m_vertices[i * verticesPerParticle + j].color.a = alpha;
+        }
+    }
+
+    // Stream all the vertices to the GPU at once; updating the buffer with at least
+    // as many vertices as it contains orphans its previous storage instead of waiting
+    // for the draw calls that still use it
+    if (VertexBuffer::isAvailable() && !m_vertices.empty())
+    {
+        // The buffer is only created when the system is drawn, so that particles can be simulated without a context
+        if (!m_buffer)
+            m_buffer = new VertexBuffer((m_renderMode == PointSprites) ? Points : Triangles, VertexBuffer::Stream);
+
+        if (!m_buffer->getNativeHandle())
+            m_buffer->create(m_vertices.size());
+
+        if (!m_buffer->update(&m_vertices[0], m_vertices.size(), 0))
+            m_buffer->create(0);
+    }
+}
+
+} // namespace sf
@@ -0,0 +1,538 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PolygonShape.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+    typedef std::vector<sf::Vector2f> Contour;
+
+    // Compute the z component of the cross product of two vectors
+    float crossProduct(const sf::Vector2f& p1, const sf::Vector2f& p2)
+    {
+        return p1.x * p2.y - p1.y * p2.x;
+    }
+
+    // Compute twice the signed area of a contour
+    float computeArea(const Contour& contour)
+    {
+        float area = 0.f;
+        for (std::size_t i = 0; i < contour.size(); ++i)
+            area += crossProduct(contour[i], contour[(i + 1) % contour.size()]);
+        return area;
+    }
+
+    // Check whether a point is inside a triangle or on its boundary, whatever its orientation
+    bool isInTriangle(const sf::Vector2f& point, const sf::Vector2f& a, const sf::Vector2f& b, const sf::Vector2f& c)
+    {
+        float ab = crossProduct(b - a, point - a);
+        float bc = crossProduct(c - b, point - b);
+        float ca = crossProduct(a - c, point - c);
+        return ((ab >= 0.f) && (bc >= 0.f) && (ca >= 0.f)) || ((ab <= 0.f) && (bc <= 0.f) && (ca <= 0.f));
+    }
+
+    // Order holes from right to left
+    bool isRighter(const Contour* left, const Contour* right)
+    {
+        float leftMax = left->front().x;
+        for (std::size_t i = 1; i < left->size(); ++i)
+            leftMax = std::max(leftMax, (*left)[i].x);
+
+        float rightMax = right->front().x;
+        for (std::size_t i = 1; i < right->size(); ++i)
+            rightMax = std::max(rightMax, (*right)[i].x);
+
+        return leftMax > rightMax;
+    }
+
+    // Connect a clockwise hole to a counter-clockwise outer boundary with a bridge,
+    // so that both become a single boundary (see "Triangulation by Ear Clipping", D. Eberly)
+    void eliminateHole(Contour& outer, const Contour& hole)
+    {
+        // Find the rightmost point of the hole
+        std::size_t holeIndex = 0;
+        for (std::size_t i = 1; i < hole.size(); ++i)
+        {
+            if (hole[i].x > hole[holeIndex].x)
+                holeIndex = i;
+        }
+
+        const sf::Vector2f& point = hole[holeIndex];
+
+        // Cast a ray from it towards +x, and find the closest edge of the outer boundary that it hits
+        std::size_t count = outer.size();
+        std::size_t outerIndex = count;
+        sf::Vector2f intersection;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const sf::Vector2f& a = outer[i];
+            const sf::Vector2f& b = outer[(i + 1) % count];
+
+            if ((a.y > point.y) == (b.y > point.y))
+                continue;
+
+            float x = a.x + (point.y - a.y) * (b.x - a.x) / (b.y - a.y);
+            if ((x < point.x) || ((outerIndex < count) && (x >= intersection.x)))
+                continue;
+
+            // The candidate for the bridge is the endpoint of the edge that is the furthest along the ray
+            intersection = sf::Vector2f(x, point.y);
+            outerIndex = (a.x > b.x) ? i : (i + 1) % count;
+        }
+
+        // The hole is not inside the outer boundary
+        if (outerIndex == count)
+            return;
+
+        // Reflex points of the outer boundary inside the triangle formed by the hole point,
+        // the intersection and the candidate may hide the candidate: use the one that is
+        // the closest to the ray instead
+        sf::Vector2f candidate = outer[outerIndex];
+        float bestSlope = -1.f;
+        float bestDistance = 0.f;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const sf::Vector2f& current = outer[i];
+            if ((i == outerIndex) || (current == candidate))
+                continue;
+
+            const sf::Vector2f& previous = outer[(i + count - 1) % count];
+            const sf::Vector2f& next = outer[(i + 1) % count];
+            if (crossProduct(current - previous, next - current) > 0.f)
+                continue;
+
+            if (!isInTriangle(current, point, intersection, candidate))
+                continue;
+
+            sf::Vector2f direction = current - point;
+            if (direction.x <= 0.f)
+                continue;
+
+            float slope = std::fabs(direction.y) / direction.x;
+            if ((bestSlope < 0.f) || (slope < bestSlope) || ((slope == bestSlope) && (direction.x < bestDistance)))
+            {
+                bestSlope = slope;
+                bestDistance = direction.x;
+                outerIndex = i;
+            }
+        }
+
+        // Insert the hole after the bridge point: the boundary goes to the hole, around it,
+        // and back to the bridge point
+        Contour bridged;
+        bridged.reserve(count + hole.size() + 2);
+        bridged.insert(bridged.end(), outer.begin(), outer.begin() + outerIndex + 1);
+        bridged.insert(bridged.end(), hole.begin() + holeIndex, hole.end());
+        bridged.insert(bridged.end(), hole.begin(), hole.begin() + holeIndex + 1);
+        bridged.insert(bridged.end(), outer.begin() + outerIndex, outer.end());
+        outer.swap(bridged);
+    }
+
+    // Triangulate a counter-clockwise simple boundary by clipping its ears
+    void clipEars(const Contour& contour, std::vector<sf::Vertex>& triangles)
+    {
+        std::size_t count = contour.size();
+        std::vector<std::size_t> previous(count);
+        std::vector<std::size_t> next(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            previous[i] = (i + count - 1) % count;
+            next[i] = (i + 1) % count;
+        }
+
+        std::size_t current = 0;
+        std::size_t remaining = count;
+        std::size_t attempts = 0;
+
+        while (remaining > 3)
+        {
+            std::size_t before = previous[current];
+            std::size_t after = next[current];
+            const sf::Vector2f& a = contour[before];
+            const sf::Vector2f& b = contour[current];
+            const sf::Vector2f& c = contour[after];
+
+            // A vertex is an ear if it is convex and no other point of the boundary is inside
+            // its triangle (points duplicated by bridges are ignored)
+            bool ear = crossProduct(b - a, c - b) > 0.f;
+            for (std::size_t i = next[after]; ear && (i != before); i = next[i])
+            {
+                const sf::Vector2f& point = contour[i];
+                if ((point != a) && (point != b) && (point != c) && isInTriangle(point, a, b, c))
+                    ear = false;
+            }
+
+            // If no ear was found after a full turn, the remaining boundary is degenerate
+            // (collinear or overlapping points): clip anyway so that the loop terminates
+            if (ear || (attempts > remaining))
+            {
+                triangles.push_back(sf::Vertex(a));
+                triangles.push_back(sf::Vertex(b));
+                triangles.push_back(sf::Vertex(c));
+
+                next[before] = after;
+                previous[after] = before;
+                --remaining;
+                attempts = 0;
+                current = before;
+            }
+            else
+            {
+                current = after;
+                ++attempts;
+            }
+        }
+
+        triangles.push_back(sf::Vertex(contour[previous[current]]));
+        triangles.push_back(sf::Vertex(contour[current]));
+        triangles.push_back(sf::Vertex(contour[next[current]]));
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PolygonShape::PolygonShape(std::size_t pointCount) :
+m_points           (pointCount),
+m_holes            (),
+m_texture          (NULL),
+m_textureRect      (),
+m_fillColor        (255, 255, 255),
+m_vertices         (),
+m_buffer           (NULL),
+m_bounds           (),
+m_needTriangulation(true),
+m_needUpload       (true)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+PolygonShape::PolygonShape(const PolygonShape& copy) :
+Drawable           (copy),
+Transformable      (copy),
+m_points           (copy.m_points),
+m_holes            (copy.m_holes),
+m_texture          (copy.m_texture),
+m_textureRect      (copy.m_textureRect),
+m_fillColor        (copy.m_fillColor),
+m_vertices         (copy.m_vertices),
+m_buffer           (NULL),
+m_bounds           (copy.m_bounds),
+m_needTriangulation(copy.m_needTriangulation),
+m_needUpload       (true)
+{
+    // The vertex buffer is not shared, the copy creates its own when it is drawn
+}
+
+
+////////////////////////////////////////////////////////////
+PolygonShape::~PolygonShape()
+{
+    delete m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+PolygonShape& PolygonShape::operator =(const PolygonShape& right)
+{
+    if (this != &right)
+    {
+        Transformable::operator =(right);
+
+        m_points            = right.m_points;
+        m_holes             = right.m_holes;
+        m_texture           = right.m_texture;
+        m_textureRect       = right.m_textureRect;
+        m_fillColor         = right.m_fillColor;
+        m_vertices          = right.m_vertices;
+        m_bounds            = right.m_bounds;
+        m_needTriangulation = right.m_needTriangulation;
+        m_needUpload        = true;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setPointCount(std::size_t count)
+{
+    m_points.resize(count);
+    m_needTriangulation = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getPointCount() const
+{
+    return m_points.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setPoint(std::size_t index, const Vector2f& point)
+{
+    m_points[index] = point;
+    m_needTriangulation = true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f PolygonShape::getPoint(std::size_t index) const
+{
+    return m_points[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::addHole(const Vector2f* points, std::size_t count)
+{
+    if (!points || (count < 3))
+        return;
+
+    m_holes.push_back(std::vector<Vector2f>(points, points + count));
+    m_needTriangulation = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::clearHoles()
+{
+    m_holes.clear();
+    m_needTriangulation = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getHoleCount() const
+{
+    return m_holes.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setTexture(const Texture* texture, bool resetRect)
+{
+    if (texture)
+    {
+        // Recompute the texture area if requested, or if there was no texture & rect before
+        if (resetRect || (!m_texture && (m_textureRect == IntRect())))
+            setTextureRect(IntRect(0, 0, texture->getSize().x, texture->getSize().y));
+    }
+
+    // Assign the new texture
+    m_texture = texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* PolygonShape::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setTextureRect(const IntRect& rect)
+{
+    m_textureRect = rect;
+    m_needUpload = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& PolygonShape::getTextureRect() const
+{
+    return m_textureRect;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setFillColor(const Color& color)
+{
+    m_fillColor = color;
+    m_needUpload = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Color& PolygonShape::getFillColor() const
+{
+    return m_fillColor;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getTriangleCount() const
+{
+    ensureTriangulation();
+
+    return m_vertices.size() / 3;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f PolygonShape::getTrianglePoint(std::size_t index) const
+{
+    ensureTriangulation();
+
+    return m_vertices[index].position;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect PolygonShape::getLocalBounds() const
+{
+    ensureTriangulation();
+
+    return m_bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect PolygonShape::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::draw(RenderTarget& target, RenderStates states) const
+{
+    ensureTriangulation();
+
+    if (m_vertices.empty())
+        return;
+
+    updateVertices();
+
+    states.transform *= getTransform();
+    states.texture = m_texture;
+
+    if (m_buffer && m_buffer->getNativeHandle() && (m_buffer->getVertexCount() == m_vertices.size()))
+        target.draw(*m_buffer, states);
+    else
+        target.draw(&m_vertices[0], m_vertices.size(), Triangles, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::ensureTriangulation() const
+{
+    if (!m_needTriangulation)
+        return;
+
+    m_needTriangulation = false;
+    m_needUpload = true;
+    m_vertices.clear();
+    m_bounds = FloatRect();
+
+    if (m_points.size() < 3)
+        return;
+
+    // Compute the bounding rectangle of the outer boundary
+    Vector2f minimum = m_points[0];
+    Vector2f maximum = m_points[0];
+    for (std::size_t i = 1; i < m_points.size(); ++i)
+    {
+        minimum.x = std::min(minimum.x, m_points[i].x);
+        minimum.y = std::min(minimum.y, m_points[i].y);
+        maximum.x = std::max(maximum.x, m_points[i].x);
+        maximum.y = std::max(maximum.y, m_points[i].y);
+    }
+    m_bounds = FloatRect(minimum, maximum - minimum);
+
+    // Make the outer boundary counter-clockwise and the holes clockwise
+    Contour outer(m_points);
+    if (computeArea(outer) < 0.f)
+        std::reverse(outer.begin(), outer.end());
+
+    std::vector<Contour> holes(m_holes);
+    std::vector<const Contour*> sortedHoles;
+    for (std::size_t i = 0; i < holes.size(); ++i)
+    {
+        if (computeArea(holes[i]) > 0.f)
+            std::reverse(holes[i].begin(), holes[i].end());
+
+        sortedHoles.push_back(&holes[i]);
+    }
+
+    // Connect the holes to the outer boundary, from right to left so that
+    // the bridges don't cross the holes that are not connected yet
+    std::sort(sortedHoles.begin(), sortedHoles.end(), isRighter);
+    for (std::size_t i = 0; i < sortedHoles.size(); ++i)
+        eliminateHole(outer, *sortedHoles[i]);
+
+    m_vertices.reserve((outer.size() - 2) * 3);
+    clipEars(outer, m_vertices);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateVertices() const
+{
+    if (!m_needUpload)
+        return;
+
+    m_needUpload = false;
+
+    // Map the texture rectangle on the bounding rectangle of the polygon
+    for (std::size_t i = 0; i < m_vertices.size(); ++i)
+    {
+        Vertex& vertex = m_vertices[i];
+        float xratio = m_bounds.width > 0 ? (vertex.position.x - m_bounds.left) / m_bounds.width : 0;
+        float yratio = m_bounds.height > 0 ? (vertex.position.y - m_bounds.top) / m_bounds.height : 0;
+        vertex.texCoords.x = m_textureRect.left + m_textureRect.width * xratio;
+        vertex.texCoords.y = m_textureRect.top + m_textureRect.height * yratio;
+        vertex.color = m_fillColor;
+    }
+
+    // Store the triangles in the vertex buffer, so that they don't have to be sent every frame
+    if (VertexBuffer::isAvailable())
+    {
+        if (!m_buffer)
+            m_buffer = new VertexBuffer(Triangles, VertexBuffer::Static);
+
+        if (m_buffer->getVertexCount() != m_vertices.size())
+            m_buffer->create(m_vertices.size());
+
+        if (!m_buffer->update(&m_vertices[0]))
+            m_buffer->create(0);
+    }
+}
+
+} // namespace sf
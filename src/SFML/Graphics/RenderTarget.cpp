@@ -26,6 +26,8 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/CommandList.hpp>
+#include <SFML/Graphics/CoreProfileRenderer.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
@@ -37,6 +39,7 @@
 #include <SFML/System/Lock.hpp>
 #include <SFML/System/Err.hpp>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <algorithm>
 #include <map>
@@ -82,6 +85,82 @@ namespace
         return true;
     }
 
+    // Compute the bounding rectangle of the positions of an array of vertices
+    sf::FloatRect getVertexBounds(const sf::Vertex* vertices, std::size_t vertexCount)
+    {
+        float left   = vertices[0].position.x;
+        float top    = vertices[0].position.y;
+        float right  = left;
+        float bottom = top;
+
+        for (std::size_t i = 1; i < vertexCount; ++i)
+        {
+            const sf::Vector2f& position = vertices[i].position;
+            left   = std::min(left, position.x);
+            right  = std::max(right, position.x);
+            top    = std::min(top, position.y);
+            bottom = std::max(bottom, position.y);
+        }
+
+        return sf::FloatRect(left, top, right - left, bottom - top);
+    }
+
+    // 64-bit FNV-1a hashing of the commands submitted in partial redraw mode
+    sf::Uint64 hashBytes(sf::Uint64 hash, const void* data, std::size_t size)
+    {
+        const sf::Uint64 prime = (static_cast<sf::Uint64>(0x100) << 32) | 0x1B3;
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= prime;
+        }
+
+        return hash;
+    }
+
+    template <typename T>
+    sf::Uint64 hashValue(sf::Uint64 hash, const T& value)
+    {
+        return hashBytes(hash, &value, sizeof(value));
+    }
+
+    sf::Uint64 hashView(const sf::View& view)
+    {
+        sf::Uint64 hash = (static_cast<sf::Uint64>(0xCBF29CE4) << 32) | 0x84222325;
+        hash = hashBytes(hash, view.getTransform().getMatrix(), 16 * sizeof(float));
+        hash = hashValue(hash, view.getViewport());
+        return hashValue(hash, view.getScissor());
+    }
+
+    // The texture ID is the cache ID of the texture, or 0 if its content
+    // can change without notice (textures of render-textures)
+    sf::Uint64 hashStates(sf::Uint64 hash, const sf::RenderStates& states, sf::Uint64 textureId)
+    {
+        // Shader parameters and render-texture content can't be tracked,
+        // so commands that use them are considered changed every time
+        static sf::Uint64 volatileCount = 0;
+        if (states.shader || (states.texture && !textureId))
+            hash = hashValue(hash, ++volatileCount);
+
+        hash = hashBytes(hash, states.transform.getMatrix(), 16 * sizeof(float));
+        hash = hashValue(hash, states.texture);
+        hash = hashValue(hash, textureId);
+        hash = hashValue(hash, states.shader);
+        hash = hashValue(hash, states.blendMode.colorSrcFactor);
+        hash = hashValue(hash, states.blendMode.colorDstFactor);
+        hash = hashValue(hash, states.blendMode.colorEquation);
+        hash = hashValue(hash, states.blendMode.alphaSrcFactor);
+        hash = hashValue(hash, states.blendMode.alphaDstFactor);
+        hash = hashValue(hash, states.blendMode.alphaEquation);
+        hash = hashValue(hash, states.stencilMode.stencilComparison);
+        hash = hashValue(hash, states.stencilMode.stencilUpdateOperation);
+        hash = hashValue(hash, states.stencilMode.stencilReference);
+        hash = hashValue(hash, states.stencilMode.stencilMask);
+        return hashValue(hash, states.stencilMode.stencilOnly);
+    }
+
     // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
     sf::Uint32 factorToGlConstant(sf::BlendMode::Factor blendFactor)
     {
@@ -128,7 +207,7 @@ namespace
             case sf::StencilMode::Zero:      return GL_ZERO;
             case sf::StencilMode::Replace:   return GL_REPLACE;
             case sf::StencilMode::Increment: return GL_INCR;
-            case sf::StencilMode::Decrement: return GL_INCR;
+            case sf::StencilMode::Decrement: return GL_DECR;
             case sf::StencilMode::Invert:    return GL_INVERT;
         }
 
@@ -143,7 +222,7 @@ namespace
         switch (comparison)
         {
             case sf::StencilMode::Never:        return GL_NEVER;
-            case sf::StencilMode::Less:         return GL_EQUAL;
+            case sf::StencilMode::Less:         return GL_LESS;
             case sf::StencilMode::LessEqual:    return GL_LEQUAL;
             case sf::StencilMode::Greater:      return GL_GREATER;
             case sf::StencilMode::GreaterEqual: return GL_GEQUAL;
@@ -163,10 +242,17 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 RenderTarget::RenderTarget() :
-m_defaultView(),
-m_view       (),
-m_cache      (),
-m_id         (0)
+m_defaultView    (),
+m_view           (),
+m_cache          (),
+m_id             (0),
+m_commandList    (NULL),
+m_coreRenderer   (NULL),
+m_backendSelected(false),
+m_partialRedraw  (false),
+m_damage         (),
+m_signatures     (),
+m_submitCount    (0)
 {
     m_cache.glStatesSet = false;
 }
@@ -175,12 +261,24 @@ m_id         (0)
 ////////////////////////////////////////////////////////////
 RenderTarget::~RenderTarget()
 {
+    delete m_coreRenderer;
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(const Color& color)
 {
+    // Command lists only record the operation
+    if (m_commandList)
+    {
+        m_commandList->recordClear(CommandList::ClearColor, color, 0);
+        return;
+    }
+
+    // In partial redraw mode, only the damaged area is cleared
+    if (m_partialRedraw && (m_damage.width <= 0))
+        return;
+
     if (isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -199,11 +297,26 @@ void RenderTarget::clear(const Color& color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(unsigned int value)
 {
+    // Command lists only record the operation
+    if (m_commandList)
+    {
+        m_commandList->recordClear(CommandList::ClearStencil, Color(), value);
+        return;
+    }
+
+    // In partial redraw mode, only the damaged area is cleared
+    if (m_partialRedraw && (m_damage.width <= 0))
+        return;
+
     if (isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(NULL);
 
+        // The damaged area is applied with the scissor rectangle of the view
+        if (m_partialRedraw && (!m_cache.enable || m_cache.viewChanged))
+            applyCurrentView();
+
         glCheck(glClearStencil(value));
         glCheck(glClear(GL_STENCIL_BUFFER_BIT));
     }
@@ -213,11 +326,26 @@ void RenderTarget::clear(unsigned int value)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(const Color& color, unsigned int value)
 {
+    // Command lists only record the operation
+    if (m_commandList)
+    {
+        m_commandList->recordClear(CommandList::ClearBoth, color, value);
+        return;
+    }
+
+    // In partial redraw mode, only the damaged area is cleared
+    if (m_partialRedraw && (m_damage.width <= 0))
+        return;
+
     if (isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(NULL);
 
+        // The damaged area is applied with the scissor rectangle of the view
+        if (m_partialRedraw && (!m_cache.enable || m_cache.viewChanged))
+            applyCurrentView();
+
         glCheck(glClearColor(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f));
         glCheck(glClearStencil(value));
         glCheck(glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
@@ -334,6 +462,13 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
     if (!vertices || (vertexCount == 0))
         return;
 
+    // Command lists only record the draw
+    if (m_commandList)
+    {
+        m_commandList->recordDraw(vertices, vertexCount, type, states);
+        return;
+    }
+
     // GL_QUADS is unavailable on OpenGL ES
     #ifdef SFML_OPENGL_ES
         if (type == Quads)
@@ -343,64 +478,74 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
         }
     #endif
 
+    // In partial redraw mode, skip the draws that don't touch the damaged area
+    if (m_partialRedraw)
+    {
+        FloatRect bounds = states.transform.transformRect(getVertexBounds(vertices, vertexCount));
+        if (!mapRectToPixels(bounds, m_view).intersects(m_damage))
+            return;
+    }
+
     if (isActive(m_id) || setActive(true))
     {
         // Check if the vertex count is low enough so that we can pre-transform them
         bool useVertexCache = (vertexCount <= StatesCache::VertexCacheSize);
 
+        // Pre-transform the vertices and store them into the vertex cache
         if (useVertexCache)
-        {
-            // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex = m_cache.vertexCache[i];
-                vertex.position = states.transform * vertices[i].position;
-                vertex.color = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
-        }
+            states.transform.transformPoints(vertices, m_cache.vertexCache, vertexCount);
 
         setupDraw(useVertexCache, states);
 
-        // Check if texture coordinates array is needed, and update client state accordingly
-        bool enableTexCoordsArray = (states.texture || states.shader);
-        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
+        if (m_coreRenderer)
         {
-            if (enableTexCoordsArray)
-                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-            else
-                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+            // Core profiles have no client-side arrays, the vertices are streamed into a buffer
+            m_coreRenderer->draw(useVertexCache ? m_cache.vertexCache : vertices, vertexCount, type);
         }
-
-        // If we switch between non-cache and cache mode or enable texture
-        // coordinates we need to set up the pointers to the vertices' components
-        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+        else
         {
-            const char* data = reinterpret_cast<const char*>(vertices);
+            // Check if texture coordinates array is needed, and update client state accordingly
+            bool enableTexCoordsArray = (states.texture || states.shader);
+            if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
+            {
+                if (enableTexCoordsArray)
+                    glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+                else
+                    glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+            }
+
+            // If we switch between non-cache and cache mode or enable texture
+            // coordinates we need to set up the pointers to the vertices' components
+            if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+            {
+                const char* data = reinterpret_cast<const char*>(vertices);
+
+                // If we pre-transform the vertices, we must use our internal vertex cache
+                if (useVertexCache)
+                    data = reinterpret_cast<const char*>(m_cache.vertexCache);
 
-            // If we pre-transform the vertices, we must use our internal vertex cache
-            if (useVertexCache)
-                data = reinterpret_cast<const char*>(m_cache.vertexCache);
+                glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+                glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+                if (enableTexCoordsArray)
+                    glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+            }
+            else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
+            {
+                // If we enter this block, we are already using our internal vertex cache
+                const char* data = reinterpret_cast<const char*>(m_cache.vertexCache);
 
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
-            if (enableTexCoordsArray)
                 glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
-        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
-        {
-            // If we enter this block, we are already using our internal vertex cache
-            const char* data = reinterpret_cast<const char*>(m_cache.vertexCache);
+            }
 
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+            drawPrimitives(type, 0, vertexCount);
+
+            m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
         }
 
-        drawPrimitives(type, 0, vertexCount);
         cleanupDraw(states);
 
         // Update the cache
         m_cache.useVertexCache = useVertexCache;
-        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
     }
 }
 
@@ -416,6 +561,13 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& st
 void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex,
                         std::size_t vertexCount, const RenderStates& states)
 {
+    // Command lists only record the draw, the checks are performed on submission
+    if (m_commandList)
+    {
+        m_commandList->recordDraw(vertexBuffer, firstVertex, vertexCount, states);
+        return;
+    }
+
     // VertexBuffer not supported?
     if (!VertexBuffer::isAvailable())
     {
@@ -447,31 +599,92 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     {
         setupDraw(false, states);
 
-        // Bind vertex buffer
-        VertexBuffer::bind(&vertexBuffer);
+        if (m_coreRenderer)
+        {
+            m_coreRenderer->draw(vertexBuffer.getNativeHandle(), firstVertex, vertexCount, vertexBuffer.getPrimitiveType());
+        }
+        else
+        {
+            // Bind vertex buffer
+            VertexBuffer::bind(&vertexBuffer);
 
-        // Always enable texture coordinates
-        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
-            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+            // Always enable texture coordinates
+            if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
 
-        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
-        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
-        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
 
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+            drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
 
-        // Unbind vertex buffer
-        VertexBuffer::bind(NULL);
+            // Unbind vertex buffer
+            VertexBuffer::bind(NULL);
+
+            m_cache.texCoordsArrayEnabled = true;
+        }
 
         cleanupDraw(states);
 
         // Update the cache
         m_cache.useVertexCache = false;
-        m_cache.texCoordsArrayEnabled = true;
     }
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::submit(const CommandList& commandList)
+{
+    // In partial redraw mode, the commands that changed since the previous frame damage the target
+    if (m_partialRedraw && !m_commandList)
+        updateDamage(commandList);
+
+    commandList.replay(*this);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setPartialRedrawEnabled(bool enabled)
+{
+    m_partialRedraw = enabled;
+    m_damage = IntRect();
+    m_signatures.clear();
+    m_submitCount = 0;
+    m_cache.viewChanged = true;
+
+    // The first frame has to be drawn completely
+    invalidate();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isPartialRedrawEnabled() const
+{
+    return m_partialRedraw;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::invalidate()
+{
+    addDamage(IntRect(0, 0, static_cast<int>(getSize().x), static_cast<int>(getSize().y)));
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::invalidate(const FloatRect& area)
+{
+    addDamage(mapRectToPixels(area, m_view));
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& RenderTarget::getDamagedArea() const
+{
+    return m_damage;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::setActive(bool active)
 {
@@ -515,7 +728,8 @@ bool RenderTarget::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
-    if (isActive(m_id) || setActive(true))
+    // Core profiles have no state stacks, only our own states are set up
+    if ((isActive(m_id) || setActive(true)) && !selectBackend())
     {
         #ifdef SFML_DEBUG
             // make sure that the user didn't leave an unchecked OpenGL error
@@ -547,7 +761,7 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
-    if (isActive(m_id) || setActive(true))
+    if ((isActive(m_id) || setActive(true)) && !selectBackend())
     {
         glCheck(glMatrixMode(GL_PROJECTION));
         glCheck(glPopMatrix());
@@ -581,28 +795,45 @@ void RenderTarget::resetGLStates()
         // Make sure that extensions are initialized
         priv::ensureExtensionsInit();
 
-        // Make sure that the texture unit which is active is the number 0
-        if (GLEXT_multitexture)
+        if (selectBackend())
         {
-            glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
-            glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+            // Bind the shader and vertex array object of the backend, which also selects texture unit 0
+            m_coreRenderer->activate();
+
+            // Define the default OpenGL states, the fixed-function ones don't exist in core profiles
+            glCheck(glDisable(GL_CULL_FACE));
+            glCheck(glDisable(GL_STENCIL_TEST));
+            glCheck(glDisable(GL_DEPTH_TEST));
+            glCheck(glDisable(GL_SCISSOR_TEST));
+            glCheck(glEnable(GL_BLEND));
+            glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
+        }
+        else
+        {
+            // Make sure that the texture unit which is active is the number 0
+            if (GLEXT_multitexture)
+            {
+                glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
+                glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+            }
+
+            // Define the default OpenGL states
+            glCheck(glDisable(GL_CULL_FACE));
+            glCheck(glDisable(GL_LIGHTING));
+            glCheck(glDisable(GL_STENCIL_TEST));
+            glCheck(glDisable(GL_DEPTH_TEST));
+            glCheck(glDisable(GL_ALPHA_TEST));
+            glCheck(glDisable(GL_SCISSOR_TEST));
+            glCheck(glEnable(GL_TEXTURE_2D));
+            glCheck(glEnable(GL_BLEND));
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glLoadIdentity());
+            glCheck(glEnableClientState(GL_VERTEX_ARRAY));
+            glCheck(glEnableClientState(GL_COLOR_ARRAY));
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+            glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
         }
 
-        // Define the default OpenGL states
-        glCheck(glDisable(GL_CULL_FACE));
-        glCheck(glDisable(GL_LIGHTING));
-        glCheck(glDisable(GL_STENCIL_TEST));
-        glCheck(glDisable(GL_DEPTH_TEST));
-        glCheck(glDisable(GL_ALPHA_TEST));
-        glCheck(glDisable(GL_SCISSOR_TEST));
-        glCheck(glEnable(GL_TEXTURE_2D));
-        glCheck(glEnable(GL_BLEND));
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glLoadIdentity());
-        glCheck(glEnableClientState(GL_VERTEX_ARRAY));
-        glCheck(glEnableClientState(GL_COLOR_ARRAY));
-        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-        glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
         m_cache.stencilEnabled = false;
         m_cache.scissorEnabled = false;
         m_cache.glStatesSet = true;
@@ -611,10 +842,10 @@ void RenderTarget::resetGLStates()
         applyBlendMode(BlendAlpha);
         applyStencilMode(StencilMode());
         applyTexture(NULL);
-        if (shaderAvailable)
+        if (shaderAvailable && !m_coreRenderer)
             applyShader(NULL);
 
-        if (vertexBufferAvailable)
+        if (vertexBufferAvailable && !m_coreRenderer)
             glCheck(VertexBuffer::bind(NULL));
 
         m_cache.texCoordsArrayEnabled = true;
@@ -639,6 +870,17 @@ void RenderTarget::initialize()
     // Set GL states only on first draw, so that we don't pollute user's states
     m_cache.glStatesSet = false;
 
+    // The target may have been recreated with a different context, select the backend again
+    delete m_coreRenderer;
+    m_coreRenderer = NULL;
+    m_backendSelected = false;
+
+    // The content of a recreated target is lost, it has to be drawn completely
+    m_damage = IntRect();
+    m_signatures.clear();
+    m_submitCount = 0;
+    invalidate();
+
     // Generate a unique ID for this RenderTarget to track
     // whether it is active within a specific context
     m_id = getUniqueId();
@@ -655,49 +897,52 @@ void RenderTarget::applyCurrentView()
 
     FloatRect scissor = m_view.getScissor();
 
-    if (m_cache.scissorEnabled)
-    {
-        if ((scissor.left   != 0) ||
-            (scissor.top    != 0) ||
-            (scissor.width  != 1) ||
-            (scissor.height != 1))
-        {
-            // Set the scissor rectangle
-            IntRect pixelScissor = getScissor(m_view);
-            top = getSize().y - (pixelScissor.top + pixelScissor.height);
-            glCheck(glScissor(pixelScissor.left, top, pixelScissor.width, pixelScissor.height));
-        }
-        else
-        {
-            glCheck(glDisable(GL_SCISSOR_TEST));
+    bool scissorEnabled = (scissor.left   != 0) ||
+                          (scissor.top    != 0) ||
+                          (scissor.width  != 1) ||
+                          (scissor.height != 1);
 
-            m_cache.scissorEnabled = false;
-        }
+    IntRect pixelScissor = scissorEnabled ? getScissor(m_view) : IntRect(0, 0, static_cast<int>(getSize().x), static_cast<int>(getSize().y));
+
+    // In partial redraw mode, rendering is also restricted to the damaged area
+    if (m_partialRedraw)
+    {
+        IntRect damagedScissor;
+        pixelScissor.intersects(m_damage, damagedScissor);
+        pixelScissor = damagedScissor;
+        scissorEnabled = true;
     }
-    else
+
+    if (scissorEnabled)
     {
-        if ((scissor.left   != 0) ||
-            (scissor.top    != 0) ||
-            (scissor.width  != 1) ||
-            (scissor.height != 1))
-        {
-            // Set the scissor rectangle
-            IntRect pixelScissor = getScissor(m_view);
-            top = getSize().y - (pixelScissor.top + pixelScissor.height);
-            glCheck(glScissor(pixelScissor.left, top, pixelScissor.width, pixelScissor.height));
+        // Set the scissor rectangle
+        top = getSize().y - (pixelScissor.top + pixelScissor.height);
+        glCheck(glScissor(pixelScissor.left, top, pixelScissor.width, pixelScissor.height));
 
+        if (!m_cache.scissorEnabled)
             glCheck(glEnable(GL_SCISSOR_TEST));
-
-            m_cache.scissorEnabled = true;
-        }
+    }
+    else if (m_cache.scissorEnabled)
+    {
+        glCheck(glDisable(GL_SCISSOR_TEST));
     }
 
-    // Set the projection matrix
-    glCheck(glMatrixMode(GL_PROJECTION));
-    glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
+    m_cache.scissorEnabled = scissorEnabled;
 
-    // Go back to model-view mode
-    glCheck(glMatrixMode(GL_MODELVIEW));
+    if (m_coreRenderer)
+    {
+        // Set the projection transform of the shader
+        m_coreRenderer->setViewTransform(m_view.getTransform());
+    }
+    else
+    {
+        // Set the projection matrix
+        glCheck(glMatrixMode(GL_PROJECTION));
+        glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
+
+        // Go back to model-view mode
+        glCheck(glMatrixMode(GL_MODELVIEW));
+    }
 
     m_cache.viewChanged = false;
 }
@@ -706,6 +951,20 @@ void RenderTarget::applyCurrentView()
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyBlendMode(const BlendMode& mode)
 {
+    // Separate blending is core since 2.0, core profiles don't advertise the extensions
+    if (m_coreRenderer)
+    {
+        m_coreRenderer->setBlendFunc(
+            factorToGlConstant(mode.colorSrcFactor), factorToGlConstant(mode.colorDstFactor),
+            factorToGlConstant(mode.alphaSrcFactor), factorToGlConstant(mode.alphaDstFactor));
+        m_coreRenderer->setBlendEquation(
+            equationToGlConstant(mode.colorEquation),
+            equationToGlConstant(mode.alphaEquation));
+
+        m_cache.lastBlendMode = mode;
+        return;
+    }
+
     // Apply the blend mode, falling back to the non-separate versions if necessary
     if (GLEXT_blend_func_separate)
     {
@@ -784,6 +1043,12 @@ void RenderTarget::applyStencilMode(const StencilMode& mode)
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTransform(const Transform& transform)
 {
+    if (m_coreRenderer)
+    {
+        m_coreRenderer->setModelTransform(transform);
+        return;
+    }
+
     // No need to call glMatrixMode(GL_MODELVIEW), it is always the
     // current mode (for optimization purpose, since it's the most used)
     if (transform == Transform::Identity)
@@ -796,7 +1061,34 @@ void RenderTarget::applyTransform(const Transform& transform)
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTexture(const Texture* texture)
 {
-    Texture::bind(texture, Texture::Pixels);
+    if (m_coreRenderer)
+    {
+        // Core profiles have no texture matrix, compute the one that
+        // Texture::bind would load and pass it to the shader instead
+        Transform matrix;
+        if (texture)
+        {
+            float scaleY = 1.f / texture->m_actualSize.y;
+            float offsetY = 0.f;
+
+            // If pixels are flipped we must invert the Y axis
+            if (texture->m_pixelsFlipped)
+            {
+                scaleY = -scaleY;
+                offsetY = static_cast<float>(texture->m_size.y) / texture->m_actualSize.y;
+            }
+
+            matrix = Transform(1.f / texture->m_actualSize.x, 0.f,    0.f,
+                               0.f,                           scaleY, offsetY,
+                               0.f,                           0.f,    1.f);
+        }
+
+        m_coreRenderer->setTexture(texture ? texture->m_texture : 0, matrix);
+    }
+    else
+    {
+        Texture::bind(texture, Texture::Pixels);
+    }
 
     m_cache.lastTextureId = texture ? texture->m_cacheId : 0;
 }
@@ -805,6 +1097,20 @@ void RenderTarget::applyTexture(const Texture* texture)
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyShader(const Shader* shader)
 {
+    if (m_coreRenderer)
+    {
+        // sf::Shader relies on the compatibility matrices and attributes
+        static bool warned = false;
+
+        if (shader && !warned)
+        {
+            err() << "sf::Shader is not supported with core profile contexts, the built-in shader is used instead" << std::endl;
+            warned = true;
+        }
+
+        return;
+    }
+
     Shader::bind(shader);
 }
 
@@ -816,11 +1122,15 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
     if (!m_cache.glStatesSet)
         resetGLStates();
 
+    // Another target may have bound its own shader and vertex array object in this context
+    if (m_coreRenderer && !m_cache.enable)
+        m_coreRenderer->activate();
+
     if (useVertexCache)
     {
         // Since vertices are transformed, we must use an identity transform to render them
         if (!m_cache.enable || !m_cache.useVertexCache)
-            glCheck(glLoadIdentity());
+            applyTransform(Transform::Identity);
     }
     else
     {
@@ -900,6 +1210,252 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
     m_cache.enable = true;
 }
 
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetDamage()
+{
+    if (m_partialRedraw)
+    {
+        m_damage = IntRect();
+        m_cache.viewChanged = true;
+    }
+
+    // Lists that weren't submitted in this frame have nothing to be compared to anymore
+    m_signatures.resize(m_submitCount);
+    m_submitCount = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::saveFrame(Texture& frame)
+{
+    IntRect area;
+    if (!m_damage.intersects(IntRect(0, 0, static_cast<int>(getSize().x), static_cast<int>(getSize().y)), area))
+        return;
+
+    if (isActive(m_id) || setActive(true))
+    {
+        if (!m_cache.glStatesSet)
+            resetGLStates();
+
+        // Bind the texture through the states cache, so that the next draws rebind theirs
+        applyTexture(&frame);
+
+        // Both the target and the texture have their origin at the bottom-left corner in OpenGL
+        int bottom = static_cast<int>(getSize().y) - (area.top + area.height);
+        glCheck(glCopyTexSubImage2D(GL_TEXTURE_2D, 0, area.left, bottom, area.left, bottom, area.width, area.height));
+
+        frame.m_hasMipmap = false;
+        frame.m_pixelsFlipped = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::restoreFrame(const Texture& frame)
+{
+    Vector2f size(static_cast<float>(getSize().x), static_cast<float>(getSize().y));
+
+    Vertex vertices[4] =
+    {
+        Vertex(Vector2f(0.f, 0.f), Vector2f(0.f, 0.f)),
+        Vertex(Vector2f(0.f, size.y), Vector2f(0.f, size.y)),
+        Vertex(Vector2f(size.x, 0.f), Vector2f(size.x, 0.f)),
+        Vertex(size, size)
+    };
+
+    RenderStates states(BlendNone);
+    states.texture = &frame;
+
+    // Draw the copy with a pixel view, over the whole target
+    View view = m_view;
+    bool partialRedraw = m_partialRedraw;
+    m_partialRedraw = false;
+    setView(View(FloatRect(0.f, 0.f, size.x, size.y)));
+
+    draw(vertices, 4, TriangleStrip, states);
+
+    setView(view);
+    m_partialRedraw = partialRedraw;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::selectBackend()
+{
+    if (!m_backendSelected)
+    {
+        m_backendSelected = true;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        if (priv::CoreProfileRenderer::isRequired())
+        {
+            m_coreRenderer = new priv::CoreProfileRenderer;
+
+            if (!m_coreRenderer->create())
+            {
+                err() << "Failed to set up rendering for the core profile context, drawing will fail" << std::endl;
+
+                delete m_coreRenderer;
+                m_coreRenderer = NULL;
+            }
+        }
+    }
+
+    return m_coreRenderer != NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect RenderTarget::mapRectToPixels(const FloatRect& area, const View& view) const
+{
+    // Map the area to normalized device coordinates, then to the viewport
+    FloatRect normalized = view.getTransform().transformRect(area);
+    IntRect viewport = getViewport(view);
+
+    float left   = viewport.left + ( normalized.left + 1.f)                      / 2.f * viewport.width;
+    float right  = viewport.left + ( normalized.left + normalized.width + 1.f)   / 2.f * viewport.width;
+    float top    = viewport.top  + (-normalized.top  - normalized.height + 1.f)  / 2.f * viewport.height;
+    float bottom = viewport.top  + (-normalized.top  + 1.f)                      / 2.f * viewport.height;
+
+    // Round outwards with a pixel of margin for rasterization rules and lines,
+    // clamping first so that distant geometry doesn't overflow the conversion
+    float minX = static_cast<float>(viewport.left - 1);
+    float minY = static_cast<float>(viewport.top - 1);
+    float maxX = static_cast<float>(viewport.left + viewport.width + 1);
+    float maxY = static_cast<float>(viewport.top + viewport.height + 1);
+
+    int pixelLeft   = static_cast<int>(std::floor(std::min(std::max(left, minX), maxX))) - 1;
+    int pixelTop    = static_cast<int>(std::floor(std::min(std::max(top, minY), maxY))) - 1;
+    int pixelRight  = static_cast<int>(std::ceil(std::min(std::max(right, minX), maxX))) + 1;
+    int pixelBottom = static_cast<int>(std::ceil(std::min(std::max(bottom, minY), maxY))) + 1;
+
+    IntRect pixels;
+    IntRect(pixelLeft, pixelTop, pixelRight - pixelLeft, pixelBottom - pixelTop).intersects(viewport, pixels);
+
+    return pixels;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::addDamage(const IntRect& area)
+{
+    if (!m_partialRedraw || (area.width <= 0) || (area.height <= 0))
+        return;
+
+    if ((m_damage.width <= 0) || (m_damage.height <= 0))
+    {
+        m_damage = area;
+    }
+    else
+    {
+        int left   = std::min(m_damage.left, area.left);
+        int top    = std::min(m_damage.top, area.top);
+        int right  = std::max(m_damage.left + m_damage.width, area.left + area.width);
+        int bottom = std::max(m_damage.top + m_damage.height, area.top + area.height);
+
+        m_damage = IntRect(left, top, right - left, bottom - top);
+    }
+
+    // The damaged area is applied with the scissor rectangle of the view
+    m_cache.viewChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::updateDamage(const CommandList& commandList)
+{
+    const Uint64 offsetBasis = (static_cast<Uint64>(0xCBF29CE4) << 32) | 0x84222325;
+
+    Signatures signatures;
+    signatures.reserve(commandList.m_commands.size());
+
+    // The commands of the list are executed with the current view until the list changes it
+    const View* view = &m_view;
+    Uint64 viewHash = hashView(m_view);
+
+    for (std::vector<CommandList::Command>::const_iterator it = commandList.m_commands.begin(); it != commandList.m_commands.end(); ++it)
+    {
+        const CommandList::Command& command = *it;
+
+        if (command.type == CommandList::SetView)
+        {
+            view = &commandList.m_views[command.first];
+            viewHash = hashView(*view);
+            continue;
+        }
+
+        CommandSignature signature;
+        Uint64 hash = hashValue(offsetBasis, command.type);
+
+        if (command.type == CommandList::DrawVertices)
+        {
+            const Vertex* vertices = &commandList.m_vertices[command.first];
+            Uint64 textureId = (command.states.texture && !command.states.texture->m_fboAttachment) ? command.states.texture->m_cacheId : 0;
+
+            hash = hashValue(hash, command.primitiveType);
+            hash = hashValue(hash, viewHash);
+            hash = hashStates(hash, command.states, textureId);
+            hash = hashBytes(hash, vertices, command.count * sizeof(Vertex));
+
+            signature.bounds = mapRectToPixels(getVertexBounds(vertices, command.count), *view);
+        }
+        else if (command.type == CommandList::DrawVertexBuffer)
+        {
+            // The content of vertex buffers isn't tracked, changes must be reported with invalidate
+            Uint64 textureId = (command.states.texture && !command.states.texture->m_fboAttachment) ? command.states.texture->m_cacheId : 0;
+
+            hash = hashValue(hash, command.vertexBuffer);
+            hash = hashValue(hash, command.first);
+            hash = hashValue(hash, command.count);
+            hash = hashValue(hash, viewHash);
+            hash = hashStates(hash, command.states, textureId);
+
+            signature.bounds = getViewport(*view);
+        }
+        else
+        {
+            hash = hashValue(hash, command.color);
+            hash = hashValue(hash, command.stencilValue);
+
+            signature.bounds = IntRect(0, 0, static_cast<int>(getSize().x), static_cast<int>(getSize().y));
+        }
+
+        signature.hash = hash;
+        signatures.push_back(signature);
+    }
+
+    // The list is compared to the one submitted at the same position in the previous frame
+    if (m_submitCount >= m_signatures.size())
+        m_signatures.resize(m_submitCount + 1);
+
+    Signatures& lastSignatures = m_signatures[m_submitCount++];
+
+    // Commands that differ from the ones at the same position in the previous list damage
+    // the pixels that both of them touch; outside of these pixels, the same commands are
+    // executed on the same content as in the previous frame, so the result doesn't change
+    std::size_t commonCount = std::min(signatures.size(), lastSignatures.size());
+
+    for (std::size_t i = 0; i < commonCount; ++i)
+    {
+        if (signatures[i].hash != lastSignatures[i].hash)
+        {
+            addDamage(signatures[i].bounds);
+            addDamage(lastSignatures[i].bounds);
+        }
+    }
+
+    for (std::size_t i = commonCount; i < signatures.size(); ++i)
+        addDamage(signatures[i].bounds);
+
+    for (std::size_t i = commonCount; i < lastSignatures.size(); ++i)
+        addDamage(lastSignatures[i].bounds);
+
+    lastSignatures.swap(signatures);
+}
+
 } // namespace sf
 
 
@@ -35,7 +35,8 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 RenderTexture::RenderTexture() :
-m_impl(NULL)
+m_impl       (NULL),
+m_autoResolve(true)
 {
 
 }
@@ -161,9 +162,47 @@ bool RenderTexture::setActive(bool active)
 void RenderTexture::display()
 {
     // Update the target texture
-    if (m_impl && (priv::RenderTextureImplFBO::isAvailable() || setActive(true)))
+    if (m_impl && (m_texture.m_fboAttachment || setActive(true)))
     {
-        m_impl->updateTexture(m_texture.m_texture);
+        // In partial redraw mode, only the damaged area has to be updated
+        if (m_autoResolve)
+            m_impl->updateTexture(m_texture.m_texture, isPartialRedrawEnabled() ? getDamagedArea() : IntRect(0, 0, static_cast<int>(m_texture.m_size.x), static_cast<int>(m_texture.m_size.y)));
+
+        m_texture.m_pixelsFlipped = true;
+        m_texture.invalidateMipmap();
+    }
+
+    resetDamage();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexture::setAutoResolveEnabled(bool enabled)
+{
+    m_autoResolve = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTexture::isAutoResolveEnabled() const
+{
+    return m_autoResolve;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexture::resolve()
+{
+    resolve(IntRect(0, 0, static_cast<int>(m_texture.m_size.x), static_cast<int>(m_texture.m_size.y)));
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexture::resolve(const IntRect& area)
+{
+    if (m_impl && (m_texture.m_fboAttachment || setActive(true)))
+    {
+        m_impl->updateTexture(m_texture.m_texture, area);
         m_texture.m_pixelsFlipped = true;
         m_texture.invalidateMipmap();
     }
@@ -28,6 +28,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/NonCopyable.hpp>
 
 
@@ -78,10 +79,14 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Update the pixels of the target texture
     ///
+    /// Only the pixels inside \a area, in target coordinates
+    /// (origin at the top-left corner), have to be updated.
+    ///
     /// \param textureId OpenGL identifier of the target texture
+    /// \param area      Area of the target to copy to the texture
     ///
     ////////////////////////////////////////////////////////////
-    virtual void updateTexture(unsigned int textureId) = 0;
+    virtual void updateTexture(unsigned int textureId, const IntRect& area) = 0;
 };
 
 } // namespace priv
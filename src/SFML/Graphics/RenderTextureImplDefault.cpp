@@ -30,6 +30,7 @@
 #include <SFML/Graphics/TextureSaver.hpp>
 #include <SFML/Window/Context.hpp>
 #include <SFML/System/Err.hpp>
+#include <algorithm>
 
 
 namespace sf
@@ -86,14 +87,25 @@ bool RenderTextureImplDefault::activate(bool active)
 
 
 ////////////////////////////////////////////////////////////
-void RenderTextureImplDefault::updateTexture(unsigned int textureId)
+void RenderTextureImplDefault::updateTexture(unsigned int textureId, const IntRect& area)
 {
+    // Clamp the area to the target, and convert it to OpenGL coordinates (origin at the bottom)
+    int left   = std::max(area.left, 0);
+    int right  = std::min(area.left + area.width, static_cast<int>(m_width));
+    int top    = std::max(area.top, 0);
+    int bottom = std::min(area.top + area.height, static_cast<int>(m_height));
+
+    if ((left >= right) || (top >= bottom))
+        return;
+
+    int glBottom = static_cast<int>(m_height) - bottom;
+
     // Make sure that the current texture binding will be preserved
     priv::TextureSaver save;
 
     // Copy the rendered pixels to the texture
     glCheck(glBindTexture(GL_TEXTURE_2D, textureId));
-    glCheck(glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, m_width, m_height));
+    glCheck(glCopyTexSubImage2D(GL_TEXTURE_2D, 0, left, glBottom, left, glBottom, right - left, bottom - top));
 }
 
 } // namespace priv
@@ -94,10 +94,14 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Update the pixels of the target texture
     ///
+    /// Only the pixels inside \a area, in target coordinates
+    /// (origin at the top-left corner), have to be updated.
+    ///
     /// \param textureId OpenGL identifier of the target texture
+    /// \param area      Area of the target to copy to the texture
     ///
     ////////////////////////////////////////////////////////////
-    virtual void updateTexture(unsigned textureId);
+    virtual void updateTexture(unsigned textureId, const IntRect& area);
 
     ////////////////////////////////////////////////////////////
     // Member data
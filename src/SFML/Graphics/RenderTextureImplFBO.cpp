@@ -31,8 +31,10 @@
 #include <SFML/System/Mutex.hpp>
 #include <SFML/System/Lock.hpp>
 #include <SFML/System/Err.hpp>
+#include <algorithm>
 #include <utility>
 #include <set>
+#include <vector>
 
 
 namespace
@@ -42,13 +44,13 @@ namespace
     // RenderTextureImplFBO is still alive
     std::set<std::map<sf::Uint64, unsigned int>*> frameBuffers;
 
-    // Set to track all stale FBOs
+    // Stale FBOs, grouped by context
     // This is used to free stale FBOs after their owning
     // RenderTextureImplFBO has already been destroyed
     // An FBO cannot be destroyed until it's containing context
     // becomes active, so the destruction of the RenderTextureImplFBO
     // has to be decoupled from the destruction of the FBOs themselves
-    std::set<std::pair<sf::Uint64, unsigned int> > staleFrameBuffers;
+    std::map<sf::Uint64, std::vector<unsigned int> > staleFrameBuffers;
 
     // Mutex to protect both active and stale frame buffer sets
     sf::Mutex mutex;
@@ -58,21 +60,17 @@ namespace
     // might trigger deletion of its contained stale FBOs
     void destroyStaleFBOs()
     {
-        sf::Uint64 contextId = sf::Context::getActiveContextId();
+        std::map<sf::Uint64, std::vector<unsigned int> >::iterator iter = staleFrameBuffers.find(sf::Context::getActiveContextId());
 
-        for (std::set<std::pair<sf::Uint64, unsigned int> >::iterator iter = staleFrameBuffers.begin(); iter != staleFrameBuffers.end();)
+        if (iter != staleFrameBuffers.end())
         {
-            if (iter->first == contextId)
-            {
-                GLuint frameBuffer = static_cast<GLuint>(iter->second);
-                glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
-
-                staleFrameBuffers.erase(iter++);
-            }
-            else
+            for (std::vector<unsigned int>::const_iterator frameBuffer = iter->second.begin(); frameBuffer != iter->second.end(); ++frameBuffer)
             {
-                ++iter;
+                GLuint id = static_cast<GLuint>(*frameBuffer);
+                glCheck(GLEXT_glDeleteFramebuffers(1, &id));
             }
+
+            staleFrameBuffers.erase(iter);
         }
     }
 
@@ -113,14 +111,17 @@ namespace priv
 {
 ////////////////////////////////////////////////////////////
 RenderTextureImplFBO::RenderTextureImplFBO() :
-m_depthStencilBuffer(0),
-m_colorBuffer       (0),
-m_width             (0),
-m_height            (0),
-m_context           (NULL),
-m_textureId         (0),
-m_multisample       (false),
-m_stencil           (false)
+m_depthStencilBuffer          (0),
+m_colorBuffer                 (0),
+m_width                       (0),
+m_height                      (0),
+m_context                     (NULL),
+m_textureId                   (0),
+m_multisample                 (false),
+m_stencil                     (false),
+m_cachedContextId             (0),
+m_cachedFrameBuffer           (0),
+m_cachedMultisampleFrameBuffer(0)
 {
     Lock lock(mutex);
 
@@ -160,10 +161,10 @@ RenderTextureImplFBO::~RenderTextureImplFBO()
 
     // Move all frame buffer objects to stale set
     for (std::map<Uint64, unsigned int>::iterator iter = m_frameBuffers.begin(); iter != m_frameBuffers.end(); ++iter)
-        staleFrameBuffers.insert(std::make_pair(iter->first, iter->second));
+        staleFrameBuffers[iter->first].push_back(iter->second);
 
     for (std::map<Uint64, unsigned int>::iterator iter = m_multisampleFrameBuffers.begin(); iter != m_multisampleFrameBuffers.end(); ++iter)
-        staleFrameBuffers.insert(std::make_pair(iter->first, iter->second));
+        staleFrameBuffers[iter->first].push_back(iter->second);
 
     // Clean up FBOs
     destroyStaleFBOs();
@@ -492,10 +493,16 @@ bool RenderTextureImplFBO::createFrameBuffer()
             // Insert the FBO into our map
             m_multisampleFrameBuffers.insert(std::make_pair(Context::getActiveContextId(), static_cast<unsigned int>(multisampleFrameBuffer)));
         }
+
+        m_cachedMultisampleFrameBuffer = static_cast<unsigned int>(multisampleFrameBuffer);
     }
 
 #endif
 
+    // Remember the FBOs of the context, so that the next activations don't have to look them up
+    m_cachedContextId = Context::getActiveContextId();
+    m_cachedFrameBuffer = static_cast<unsigned int>(frameBuffer);
+
     return true;
 }
 
@@ -531,35 +538,32 @@ bool RenderTextureImplFBO::activate(bool active)
         }
     }
 
+    // Context identifiers are never reused, so the cached FBOs can't belong to a destroyed context
+    if (contextId == m_cachedContextId)
+    {
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, m_multisample ? m_cachedMultisampleFrameBuffer : m_cachedFrameBuffer));
+
+        return true;
+    }
+
     // Lookup the FBO corresponding to the currently active context
     // If none is found, there is no FBO corresponding to the
     // currently active context so we will have to create a new FBO
     {
         Lock lock(mutex);
 
-        std::map<Uint64, unsigned int>::iterator iter;
-        
-        if (m_multisample)
-        {
-            iter = m_multisampleFrameBuffers.find(contextId);
-
-            if (iter != m_multisampleFrameBuffers.end())
-            {
-                glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, iter->second));
+        std::map<Uint64, unsigned int>::iterator iter = m_frameBuffers.find(contextId);
+        std::map<Uint64, unsigned int>::iterator multisampleIter = m_multisampleFrameBuffers.find(contextId);
 
-                return true;
-            }
-        }
-        else
+        if ((iter != m_frameBuffers.end()) && (!m_multisample || (multisampleIter != m_multisampleFrameBuffers.end())))
         {
-            iter = m_frameBuffers.find(contextId);
+            m_cachedContextId = contextId;
+            m_cachedFrameBuffer = iter->second;
+            m_cachedMultisampleFrameBuffer = m_multisample ? multisampleIter->second : 0;
 
-            if (iter != m_frameBuffers.end())
-            {
-                glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, iter->second));
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, m_multisample ? m_cachedMultisampleFrameBuffer : m_cachedFrameBuffer));
 
-                return true;
-            }
+            return true;
         }
     }
 
@@ -568,7 +572,7 @@ bool RenderTextureImplFBO::activate(bool active)
 
 
 ////////////////////////////////////////////////////////////
-void RenderTextureImplFBO::updateTexture(unsigned int)
+void RenderTextureImplFBO::updateTexture(unsigned int, const IntRect& area)
 {
     // If multisampling is enabled, we need to resolve by blitting
     // from our FBO with multisample renderbuffer attachments
@@ -580,20 +584,23 @@ void RenderTextureImplFBO::updateTexture(unsigned int)
     // are already available within the current context
     if (m_multisample && m_width && m_height && activate(true))
     {
-        Uint64 contextId = Context::getActiveContextId();
-
-        Lock lock(mutex);
-
-        std::map<Uint64, unsigned int>::iterator iter = m_frameBuffers.find(contextId);
-        std::map<Uint64, unsigned int>::iterator multisampleIter = m_multisampleFrameBuffers.find(contextId);
-
-        if ((iter != m_frameBuffers.end()) && (multisampleIter != m_multisampleFrameBuffers.end()))
-        {
-            // Set up the blit target (draw framebuffer) and blit (from the read framebuffer, our multisample FBO)
-            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, iter->second));
-            glCheck(GLEXT_glBlitFramebuffer(0, 0, m_width, m_height, 0, 0, m_width, m_height, GL_COLOR_BUFFER_BIT, GL_NEAREST));
-            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, multisampleIter->second));
-        }
+        // Clamp the area to the attachments, and convert it to OpenGL coordinates (origin at the bottom)
+        int left   = std::max(area.left, 0);
+        int right  = std::min(area.left + area.width, static_cast<int>(m_width));
+        int top    = std::max(area.top, 0);
+        int bottom = std::min(area.top + area.height, static_cast<int>(m_height));
+
+        if ((left >= right) || (top >= bottom))
+            return;
+
+        int glBottom = static_cast<int>(m_height) - bottom;
+        int glTop    = static_cast<int>(m_height) - top;
+
+        // Activation filled the cache with the FBOs of the current context
+        // Set up the blit target (draw framebuffer) and blit (from the read framebuffer, our multisample FBO)
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, m_cachedFrameBuffer));
+        glCheck(GLEXT_glBlitFramebuffer(left, glBottom, right, glTop, left, glBottom, right, glTop, GL_COLOR_BUFFER_BIT, GL_NEAREST));
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, m_cachedMultisampleFrameBuffer));
     }
 
 #endif // SFML_OPENGL_ES
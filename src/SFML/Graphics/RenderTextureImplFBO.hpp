@@ -117,24 +117,31 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Update the pixels of the target texture
     ///
+    /// Only the pixels inside \a area, in target coordinates
+    /// (origin at the top-left corner), have to be updated.
+    ///
     /// \param textureId OpenGL identifier of the target texture
+    /// \param area      Area of the target to copy to the texture
     ///
     ////////////////////////////////////////////////////////////
-    virtual void updateTexture(unsigned textureId);
+    virtual void updateTexture(unsigned textureId, const IntRect& area);
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::map<Uint64, unsigned int> m_frameBuffers;            //!< OpenGL frame buffer objects per context
-    std::map<Uint64, unsigned int> m_multisampleFrameBuffers; //!< Optional per-context OpenGL frame buffer objects with multisample attachments
-    unsigned int                   m_depthStencilBuffer;      //!< Optional depth/stencil buffer attached to the frame buffer
-    unsigned int                   m_colorBuffer;             //!< Optional multisample color buffer attached to the frame buffer
-    unsigned int                   m_width;                   //!< Width of the attachments
-    unsigned int                   m_height;                  //!< Height of the attachments
-    Context*                       m_context;                 //!< Backup OpenGL context, used when none already exist
-    unsigned int                   m_textureId;               //!< The ID of the texture to attach to the FBO
-    bool                           m_multisample;             //!< Whether we have to create a multisample frame buffer as well
-    bool                           m_stencil;                 //!< Whether we have stencil attachment
+    std::map<Uint64, unsigned int> m_frameBuffers;                 //!< OpenGL frame buffer objects per context
+    std::map<Uint64, unsigned int> m_multisampleFrameBuffers;      //!< Optional per-context OpenGL frame buffer objects with multisample attachments
+    unsigned int                   m_depthStencilBuffer;           //!< Optional depth/stencil buffer attached to the frame buffer
+    unsigned int                   m_colorBuffer;                  //!< Optional multisample color buffer attached to the frame buffer
+    unsigned int                   m_width;                        //!< Width of the attachments
+    unsigned int                   m_height;                       //!< Height of the attachments
+    Context*                       m_context;                      //!< Backup OpenGL context, used when none already exist
+    unsigned int                   m_textureId;                    //!< The ID of the texture to attach to the FBO
+    bool                           m_multisample;                  //!< Whether we have to create a multisample frame buffer as well
+    bool                           m_stencil;                      //!< Whether we have stencil attachment
+    Uint64                         m_cachedContextId;              //!< Context of the last activation
+    unsigned int                   m_cachedFrameBuffer;            //!< Frame buffer object of the context of the last activation
+    unsigned int                   m_cachedMultisampleFrameBuffer; //!< Multisample frame buffer object of the context of the last activation
 };
 
 } // namespace priv
@@ -35,7 +35,8 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 RenderWindow::RenderWindow() :
-m_defaultFrameBuffer(0)
+m_defaultFrameBuffer(0),
+m_frame             ()
 {
     // Nothing to do
 }
@@ -43,7 +44,8 @@ m_defaultFrameBuffer(0)
 
 ////////////////////////////////////////////////////////////
 RenderWindow::RenderWindow(VideoMode mode, const String& title, Uint32 style, const ContextSettings& settings) :
-m_defaultFrameBuffer(0)
+m_defaultFrameBuffer(0),
+m_frame             ()
 {
     // Don't call the base class constructor because it contains virtual function calls
     Window::create(mode, title, style, settings);
@@ -52,7 +54,8 @@ m_defaultFrameBuffer(0)
 
 ////////////////////////////////////////////////////////////
 RenderWindow::RenderWindow(WindowHandle handle, const ContextSettings& settings) :
-m_defaultFrameBuffer(0)
+m_defaultFrameBuffer(0),
+m_frame             ()
 {
     // Don't call the base class constructor because it contains virtual function calls
     Window::create(handle, settings);
@@ -128,6 +131,51 @@ void RenderWindow::onResize()
 {
     // Update the current view (recompute the viewport, which is stored in relative coordinates)
     setView(getView());
+
+    // The content of the window is lost when its size changes
+    invalidate();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderWindow::onPreDisplay()
+{
+    // The back buffer is undefined after it is displayed, so in partial
+    // redraw mode a copy of the frame is kept to start the next one from
+    if (!isPartialRedrawEnabled())
+        return true;
+
+    Vector2u size = getSize();
+    if (m_frame.getSize() != size)
+    {
+        // A new copy has to be filled completely; the window has been
+        // redrawn completely since it got this size, as resizing invalidates it
+        m_frame.create(size.x, size.y);
+        invalidate();
+    }
+
+    // Without damage, the draws were skipped: the frame on screen is still up to date and
+    // the back buffer still holds it, so there's nothing to copy, display or restore
+    if (getDamagedArea().width <= 0)
+    {
+        resetDamage();
+        return false;
+    }
+
+    if (m_frame.getSize() == size)
+        saveFrame(m_frame);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderWindow::onPostDisplay()
+{
+    if (isPartialRedrawEnabled() && (m_frame.getSize() == getSize()))
+        restoreFrame(m_frame);
+
+    resetDamage();
 }
 
 } // namespace sf
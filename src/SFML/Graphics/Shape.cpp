@@ -30,6 +30,7 @@
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/System/Err.hpp>
 #include <cmath>
+#include <vector>
 
 
 namespace
@@ -49,6 +50,29 @@ namespace
     {
         return p1.x * p2.x + p1.y * p2.y;
     }
+
+    // Compute the z component of the cross product of two vectors
+    float crossProduct(const sf::Vector2f& p1, const sf::Vector2f& p2)
+    {
+        return p1.x * p2.y - p1.y * p2.x;
+    }
+
+    // Compute the offset direction at a point joining two segments of normals n1 and n2,
+    // scaled so that offsetting along it keeps the distance to both segments
+    sf::Vector2f computeMiter(const sf::Vector2f& n1, const sf::Vector2f& n2)
+    {
+        // Segments going back on each other have no miter, use the first normal
+        float factor = 1.f + dotProduct(n1, n2);
+        return (factor > 0.0001f) ? (n1 + n2) / factor : n1;
+    }
+
+    // Append a triangle to a vertex array
+    void appendTriangle(sf::VertexArray& vertices, const sf::Vector2f& p1, const sf::Vector2f& p2, const sf::Vector2f& p3)
+    {
+        vertices.append(sf::Vertex(p1));
+        vertices.append(sf::Vertex(p2));
+        vertices.append(sf::Vertex(p3));
+    }
 }
 
 
@@ -86,7 +110,7 @@ const Texture* Shape::getTexture() const
 void Shape::setTextureRect(const IntRect& rect)
 {
     m_textureRect = rect;
-    updateTexCoords();
+    m_dirtyFlags |= TexCoordsDirty;
 }
 
 
@@ -101,7 +125,7 @@ const IntRect& Shape::getTextureRect() const
 void Shape::setFillColor(const Color& color)
 {
     m_fillColor = color;
-    updateFillColors();
+    m_dirtyFlags |= FillColorsDirty;
 }
 
 
@@ -116,7 +140,7 @@ const Color& Shape::getFillColor() const
 void Shape::setOutlineColor(const Color& color)
 {
     m_outlineColor = color;
-    updateOutlineColors();
+    m_dirtyFlags |= OutlineColorsDirty;
 }
 
 
@@ -131,7 +155,7 @@ const Color& Shape::getOutlineColor() const
 void Shape::setOutlineThickness(float thickness)
 {
     m_outlineThickness = thickness;
-    update(); // recompute everything because the whole shape must be offset
+    m_dirtyFlags |= OutlineDirty;
 }
 
 
@@ -142,9 +166,56 @@ float Shape::getOutlineThickness() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Shape::setOutlineJoin(OutlineJoin join)
+{
+    m_outlineJoin = join;
+    m_dirtyFlags |= OutlineDirty;
+}
+
+
+////////////////////////////////////////////////////////////
+Shape::OutlineJoin Shape::getOutlineJoin() const
+{
+    return m_outlineJoin;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::setMiterLimit(float limit)
+{
+    m_miterLimit = limit;
+    m_dirtyFlags |= OutlineDirty;
+}
+
+
+////////////////////////////////////////////////////////////
+float Shape::getMiterLimit() const
+{
+    return m_miterLimit;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::setEdgeFringe(float width)
+{
+    m_edgeFringe = width;
+    m_dirtyFlags |= OutlineDirty;
+}
+
+
+////////////////////////////////////////////////////////////
+float Shape::getEdgeFringe() const
+{
+    return m_edgeFringe;
+}
+
+
 ////////////////////////////////////////////////////////////
 FloatRect Shape::getLocalBounds() const
 {
+    ensureGeometryUpdate();
+
     return m_bounds;
 }
 
@@ -163,16 +234,82 @@ m_textureRect     (),
 m_fillColor       (255, 255, 255),
 m_outlineColor    (255, 255, 255),
 m_outlineThickness(0),
+m_outlineJoin     (MiterJoin),
+m_miterLimit      (4.f),
+m_edgeFringe      (0.f),
 m_vertices        (TriangleFan),
-m_outlineVertices (TriangleStrip),
+m_outlineVertices (Triangles),
 m_insideBounds    (),
-m_bounds          ()
+m_bounds          (),
+m_fringeStart     (0),
+m_dirtyFlags      (0)
 {
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shape::update()
+{
+    m_dirtyFlags |= PointsDirty;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::draw(RenderTarget& target, RenderStates states) const
+{
+    ensureGeometryUpdate();
+
+    states.transform *= getTransform();
+
+    // Render the inside
+    states.texture = m_texture;
+    target.draw(m_vertices, states);
+
+    // Render the outline and the fringe
+    if (m_outlineVertices.getVertexCount() > 0)
+    {
+        states.texture = NULL;
+        target.draw(m_outlineVertices, states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::ensureGeometryUpdate() const
+{
+    if (!m_dirtyFlags)
+        return;
+
+    // New points change the fill vertices and everything that is computed from them
+    if (m_dirtyFlags & PointsDirty)
+    {
+        updatePoints();
+        m_dirtyFlags |= FillColorsDirty | TexCoordsDirty | OutlineDirty;
+    }
+
+    // The outline may gain new vertices, which need their color; and without
+    // an outline, the fringe takes the fill color
+    if ((m_dirtyFlags & OutlineDirty) || ((m_dirtyFlags & FillColorsDirty) && (m_outlineThickness == 0.f)))
+        m_dirtyFlags |= OutlineColorsDirty;
+
+    if (m_dirtyFlags & FillColorsDirty)
+        updateFillColors();
+
+    if (m_dirtyFlags & TexCoordsDirty)
+        updateTexCoords();
+
+    if (m_dirtyFlags & OutlineDirty)
+        updateOutline();
+
+    if (m_dirtyFlags & OutlineColorsDirty)
+        updateOutlineColors();
+
+    m_dirtyFlags = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updatePoints() const
 {
     // Get the total number of points of the shape
     std::size_t count = getPointCount();
@@ -197,38 +334,11 @@ void Shape::update()
     // Compute the center and make it the first vertex
     m_vertices[0].position.x = m_insideBounds.left + m_insideBounds.width / 2;
     m_vertices[0].position.y = m_insideBounds.top + m_insideBounds.height / 2;
-
-    // Color
-    updateFillColors();
-
-    // Texture coordinates
-    updateTexCoords();
-
-    // Outline
-    updateOutline();
-}
-
-
-////////////////////////////////////////////////////////////
-void Shape::draw(RenderTarget& target, RenderStates states) const
-{
-    states.transform *= getTransform();
-
-    // Render the inside
-    states.texture = m_texture;
-    target.draw(m_vertices, states);
-
-    // Render the outline
-    if (m_outlineThickness != 0)
-    {
-        states.texture = NULL;
-        target.draw(m_outlineVertices, states);
-    }
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateFillColors()
+void Shape::updateFillColors() const
 {
     for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
         m_vertices[i].color = m_fillColor;
@@ -236,7 +346,7 @@ void Shape::updateFillColors()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateTexCoords()
+void Shape::updateTexCoords() const
 {
     for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
     {
@@ -249,54 +359,153 @@ void Shape::updateTexCoords()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutline()
+void Shape::updateOutline() const
 {
-    // Return if there is no outline
-    if (m_outlineThickness == 0.f)
+    m_outlineVertices.clear();
+    m_fringeStart = 0;
+
+    // Return if there is no outline nor fringe, or no shape to outline
+    if (((m_outlineThickness == 0.f) && (m_edgeFringe <= 0.f)) || (m_vertices.getVertexCount() == 0))
     {
-        m_outlineVertices.clear();
         m_bounds = m_insideBounds;
         return;
     }
 
-    std::size_t count = m_vertices.getVertexCount() - 2;
-    m_outlineVertices.resize((count + 1) * 2);
+    // Read the fill vertices through a const reference, so that their cached bounds stay valid
+    const VertexArray& vertices = m_vertices;
+    std::size_t count = vertices.getVertexCount() - 2;
 
+    // Find the orientation of the points, so that normals can be flipped towards the outside
+    // (this depends on the order in which the points were defined)
+    float area = 0.f;
     for (std::size_t i = 0; i < count; ++i)
+        area += crossProduct(vertices[i + 1].position, vertices[i + 2].position);
+    float orientation = (area > 0.f) ? -1.f : 1.f;
+
+    // Points of the outer edge of the shape, around which the fringe is built
+    std::vector<Vector2f> edge;
+
+    if (m_outlineThickness != 0.f)
     {
-        std::size_t index = i + 1;
-
-        // Get the two segments shared by the current point
-        Vector2f p0 = (i == 0) ? m_vertices[count].position : m_vertices[index - 1].position;
-        Vector2f p1 = m_vertices[index].position;
-        Vector2f p2 = m_vertices[index + 1].position;
-
-        // Compute their normal
-        Vector2f n1 = computeNormal(p0, p1);
-        Vector2f n2 = computeNormal(p1, p2);
-
-        // Make sure that the normals point towards the outside of the shape
-        // (this depends on the order in which the points were defined)
-        if (dotProduct(n1, m_vertices[0].position - p1) > 0)
-            n1 = -n1;
-        if (dotProduct(n2, m_vertices[0].position - p1) > 0)
-            n2 = -n2;
-
-        // Combine them to get the extrusion direction
-        float factor = 1.f + (n1.x * n2.x + n1.y * n2.y);
-        Vector2f normal = (n1 + n2) / factor;
-
-        // Update the outline points
-        m_outlineVertices[i * 2 + 0].position = p1;
-        m_outlineVertices[i * 2 + 1].position = p1 + normal * m_outlineThickness;
+        // Offset points where the outline edges that end and start at each point meet
+        std::vector<Vector2f> ends(count);
+        std::vector<Vector2f> starts(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::size_t index = i + 1;
+
+            // Get the two segments shared by the current point
+            Vector2f p0 = (i == 0) ? vertices[count].position : vertices[index - 1].position;
+            Vector2f p1 = vertices[index].position;
+            Vector2f p2 = vertices[index + 1].position;
+
+            // Compute their normal, pointing towards the outside of the shape
+            Vector2f n1 = computeNormal(p0, p1) * orientation;
+            Vector2f n2 = computeNormal(p1, p2) * orientation;
+            Vector2f miter = computeMiter(n1, n2);
+
+            // The outline needs a join where its two segments move away from each other;
+            // elsewhere, they simply meet at the miter point
+            bool diverging = dotProduct(n1 * m_outlineThickness, p2 - p1) < 0.f;
+            bool withinLimit = dotProduct(miter, miter) <= m_miterLimit * m_miterLimit;
+
+            if (!diverging || ((m_outlineJoin == MiterJoin) && withinLimit))
+            {
+                ends[i] = p1 + miter * m_outlineThickness;
+                starts[i] = ends[i];
+                edge.push_back(ends[i]);
+                continue;
+            }
+
+            ends[i] = p1 + n1 * m_outlineThickness;
+            starts[i] = p1 + n2 * m_outlineThickness;
+            edge.push_back(ends[i]);
+
+            if (m_outlineJoin == RoundJoin)
+            {
+                // Split the arc so that its segments stay close to the circle
+                float radius = std::fabs(m_outlineThickness);
+                float angle = std::atan2(crossProduct(n1, n2), dotProduct(n1, n2));
+                float step = (radius > 0.25f) ? 2.f * std::acos(1.f - 0.25f / radius) : 3.141592654f;
+                std::size_t segments = static_cast<std::size_t>(std::ceil(std::fabs(angle) / step));
+
+                Vector2f previous = ends[i];
+                for (std::size_t j = 1; j < segments; ++j)
+                {
+                    float rotation = angle * static_cast<float>(j) / static_cast<float>(segments);
+                    float cosine = std::cos(rotation);
+                    float sine = std::sin(rotation);
+                    Vector2f offset = n1 * m_outlineThickness;
+                    Vector2f point = p1 + Vector2f(offset.x * cosine - offset.y * sine, offset.x * sine + offset.y * cosine);
+
+                    appendTriangle(m_outlineVertices, p1, previous, point);
+                    edge.push_back(point);
+                    previous = point;
+                }
+
+                appendTriangle(m_outlineVertices, p1, previous, starts[i]);
+            }
+            else
+            {
+                appendTriangle(m_outlineVertices, p1, ends[i], starts[i]);
+            }
+
+            edge.push_back(starts[i]);
+        }
+
+        // Add the segments of the outline, between the joins
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::size_t next = (i + 1) % count;
+            Vector2f p1 = vertices[i + 1].position;
+            Vector2f p2 = vertices[next + 1].position;
+
+            appendTriangle(m_outlineVertices, p1, starts[i], ends[next]);
+            appendTriangle(m_outlineVertices, p1, ends[next], p2);
+        }
     }
 
-    // Duplicate the first point at the end, to close the outline
-    m_outlineVertices[count * 2 + 0].position = m_outlineVertices[0].position;
-    m_outlineVertices[count * 2 + 1].position = m_outlineVertices[1].position;
+    // An outline that expands towards the center leaves the points of the shape on the outer edge
+    if (m_outlineThickness <= 0.f)
+    {
+        edge.resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+            edge[i] = vertices[i + 1].position;
+    }
 
-    // Update outline colors
-    updateOutlineColors();
+    m_fringeStart = m_outlineVertices.getVertexCount();
+
+    if (m_edgeFringe > 0.f)
+    {
+        std::size_t edgeCount = edge.size();
+
+        // Extrude the outer edge, limiting the miters so that sharp corners don't produce spikes
+        std::vector<Vector2f> extruded(edgeCount);
+        for (std::size_t i = 0; i < edgeCount; ++i)
+        {
+            const Vector2f& p0 = edge[(i + edgeCount - 1) % edgeCount];
+            const Vector2f& p1 = edge[i];
+            const Vector2f& p2 = edge[(i + 1) % edgeCount];
+
+            Vector2f miter = computeMiter(computeNormal(p0, p1) * orientation, computeNormal(p1, p2) * orientation);
+            float length = std::sqrt(dotProduct(miter, miter));
+            if (length > 2.f)
+                miter *= 2.f / length;
+
+            extruded[i] = p1 + miter * m_edgeFringe;
+        }
+
+        // The fringe is made of one quad per segment of the edge; the color of its
+        // inner and outer vertices is set by updateOutlineColors
+        for (std::size_t i = 0; i < edgeCount; ++i)
+        {
+            std::size_t next = (i + 1) % edgeCount;
+
+            appendTriangle(m_outlineVertices, edge[i], extruded[i], extruded[next]);
+            appendTriangle(m_outlineVertices, edge[i], extruded[next], edge[next]);
+        }
+    }
 
     // Update the shape's bounds
     m_bounds = m_outlineVertices.getBounds();
@@ -304,10 +513,24 @@ void Shape::updateOutline()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutlineColors()
+void Shape::updateOutlineColors() const
 {
-    for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
+    std::size_t vertexCount = m_outlineVertices.getVertexCount();
+
+    for (std::size_t i = 0; i < m_fringeStart; ++i)
         m_outlineVertices[i].color = m_outlineColor;
+
+    // The fringe fades from the color of the outer edge to transparent
+    Color inner = (m_outlineThickness != 0.f) ? m_outlineColor : m_fillColor;
+    Color outer = inner;
+    outer.a = 0;
+
+    for (std::size_t i = m_fringeStart; i < vertexCount; ++i)
+    {
+        std::size_t corner = (i - m_fringeStart) % 6;
+        bool extruded = (corner == 1) || (corner == 2) || (corner == 4);
+        m_outlineVertices[i].color = extruded ? outer : inner;
+    }
 }
 
 } // namespace sf
@@ -0,0 +1,354 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SpatialIndex.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+    // Get the coordinate of the cell containing a position
+    int getCellCoordinate(float position, float cellSize)
+    {
+        return static_cast<int>(std::floor(position / cellSize));
+    }
+
+    // Build the key of a cell; coordinates are biased so that the keys
+    // of a column are contiguous and sorted in increasing y order
+    sf::Uint64 getCellKey(int x, int y)
+    {
+        sf::Uint64 biasedX = static_cast<sf::Uint32>(x) ^ 0x80000000u;
+        sf::Uint64 biasedY = static_cast<sf::Uint32>(y) ^ 0x80000000u;
+
+        return (biasedX << 32) | biasedY;
+    }
+
+    // Check whether two rectangles overlap, touching edges and empty rectangles included
+    bool overlaps(const sf::FloatRect& left, const sf::FloatRect& right)
+    {
+        return (left.left <= right.left + right.width) && (right.left <= left.left + left.width) &&
+               (left.top <= right.top + right.height)  && (right.top <= left.top + left.height);
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpatialIndex::SpatialIndex() :
+m_cellSize(256.f),
+m_objects (),
+m_freeIds (),
+m_cells   (),
+m_large   (),
+m_count   (0),
+m_visible ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SpatialIndex::SpatialIndex(float cellSize) :
+m_cellSize(cellSize),
+m_objects (),
+m_freeIds (),
+m_cells   (),
+m_large   (),
+m_count   (0),
+m_visible ()
+{
+    assert(cellSize > 0.f);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::insert(const FloatRect& bounds, const Drawable* drawable)
+{
+    std::size_t id;
+    if (m_freeIds.empty())
+    {
+        id = m_objects.size();
+        m_objects.push_back(Object());
+    }
+    else
+    {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+
+    Object& object = m_objects[id];
+    object.bounds = bounds;
+    object.drawable = drawable;
+    object.used = true;
+
+    link(id);
+    ++m_count;
+
+    return id;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::update(std::size_t id, const FloatRect& bounds)
+{
+    assert((id < m_objects.size()) && m_objects[id].used);
+
+    Object& object = m_objects[id];
+
+    // Only move the object if it changes cell
+    bool large = (bounds.width > m_cellSize) || (bounds.height > m_cellSize);
+    if (!large && !object.large)
+    {
+        int x = getCellCoordinate(bounds.left + bounds.width / 2.f, m_cellSize);
+        int y = getCellCoordinate(bounds.top + bounds.height / 2.f, m_cellSize);
+
+        if (getCellKey(x, y) == object.cell)
+        {
+            object.bounds = bounds;
+            return;
+        }
+    }
+    else if (large && object.large)
+    {
+        object.bounds = bounds;
+        return;
+    }
+
+    unlink(id);
+    object.bounds = bounds;
+    link(id);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::remove(std::size_t id)
+{
+    assert((id < m_objects.size()) && m_objects[id].used);
+
+    unlink(id);
+
+    m_objects[id].drawable = NULL;
+    m_objects[id].used = false;
+    m_freeIds.push_back(id);
+    --m_count;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::clear()
+{
+    m_objects.clear();
+    m_freeIds.clear();
+    m_cells.clear();
+    m_large.clear();
+    m_count = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::getObjectCount() const
+{
+    return m_count;
+}
+
+
+////////////////////////////////////////////////////////////
+const FloatRect& SpatialIndex::getBounds(std::size_t id) const
+{
+    assert((id < m_objects.size()) && m_objects[id].used);
+
+    return m_objects[id].bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+const Drawable* SpatialIndex::getDrawable(std::size_t id) const
+{
+    assert((id < m_objects.size()) && m_objects[id].used);
+
+    return m_objects[id].drawable;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::query(const FloatRect& area, std::vector<std::size_t>& result) const
+{
+    std::size_t first = result.size();
+
+    // Objects stored in a cell may extend past it by up to half a cell
+    float margin = m_cellSize / 2.f;
+    int left   = getCellCoordinate(area.left - margin, m_cellSize);
+    int top    = getCellCoordinate(area.top - margin, m_cellSize);
+    int right  = getCellCoordinate(area.left + area.width + margin, m_cellSize);
+    int bottom = getCellCoordinate(area.top + area.height + margin, m_cellSize);
+
+    double columns = static_cast<double>(right) - left + 1;
+    double rows = static_cast<double>(bottom) - top + 1;
+
+    if (columns * rows > static_cast<double>(m_cells.size()))
+    {
+        // The area covers more cells than there are non-empty ones, test all of them
+        for (CellMap::const_iterator cell = m_cells.begin(); cell != m_cells.end(); ++cell)
+        {
+            for (std::vector<std::size_t>::const_iterator it = cell->second.begin(); it != cell->second.end(); ++it)
+            {
+                if (overlaps(m_objects[*it].bounds, area))
+                    result.push_back(*it);
+            }
+        }
+    }
+    else
+    {
+        // Walk the columns of cells, the cells of a column have contiguous keys
+        for (int x = left; x <= right; ++x)
+        {
+            CellMap::const_iterator end = m_cells.upper_bound(getCellKey(x, bottom));
+            for (CellMap::const_iterator cell = m_cells.lower_bound(getCellKey(x, top)); cell != end; ++cell)
+            {
+                for (std::vector<std::size_t>::const_iterator it = cell->second.begin(); it != cell->second.end(); ++it)
+                {
+                    if (overlaps(m_objects[*it].bounds, area))
+                        result.push_back(*it);
+                }
+            }
+        }
+    }
+
+    // Objects larger than a cell are always tested
+    for (std::vector<std::size_t>::const_iterator it = m_large.begin(); it != m_large.end(); ++it)
+    {
+        if (overlaps(m_objects[*it].bounds, area))
+            result.push_back(*it);
+    }
+
+    std::sort(result.begin() + first, result.end());
+
+    return result.size() - first;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::query(const View& view, std::vector<std::size_t>& result) const
+{
+    return query(getViewBounds(view), result);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::draw(RenderTarget& target, const RenderStates& states) const
+{
+    // Bring the visible area back into the coordinate system of the objects
+    FloatRect area = getViewBounds(target.getView());
+    if (states.transform != Transform::Identity)
+        area = states.transform.getInverse().transformRect(area);
+
+    m_visible.clear();
+    query(area, m_visible);
+
+    std::size_t count = 0;
+    for (std::vector<std::size_t>::const_iterator it = m_visible.begin(); it != m_visible.end(); ++it)
+    {
+        const Drawable* drawable = m_objects[*it].drawable;
+        if (drawable)
+        {
+            target.draw(*drawable, states);
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect SpatialIndex::getViewBounds(const View& view)
+{
+    // The view maps its visible area to the [-1, 1] range
+    return view.getInverseTransform().transformRect(FloatRect(-1.f, -1.f, 2.f, 2.f));
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::link(std::size_t id)
+{
+    Object& object = m_objects[id];
+
+    object.large = (object.bounds.width > m_cellSize) || (object.bounds.height > m_cellSize);
+
+    if (object.large)
+    {
+        object.cell = 0;
+        object.slot = m_large.size();
+        m_large.push_back(id);
+    }
+    else
+    {
+        int x = getCellCoordinate(object.bounds.left + object.bounds.width / 2.f, m_cellSize);
+        int y = getCellCoordinate(object.bounds.top + object.bounds.height / 2.f, m_cellSize);
+
+        std::vector<std::size_t>& cell = m_cells[getCellKey(x, y)];
+
+        object.cell = getCellKey(x, y);
+        object.slot = cell.size();
+        cell.push_back(id);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::unlink(std::size_t id)
+{
+    Object& object = m_objects[id];
+
+    std::vector<std::size_t>* ids = &m_large;
+    CellMap::iterator cell = m_cells.end();
+
+    if (!object.large)
+    {
+        cell = m_cells.find(object.cell);
+        assert(cell != m_cells.end());
+        ids = &cell->second;
+    }
+
+    // Move the last object of the list in place of the removed one
+    std::size_t last = ids->back();
+    (*ids)[object.slot] = last;
+    m_objects[last].slot = object.slot;
+    ids->pop_back();
+
+    // Release empty cells so that they are not visited anymore
+    if ((cell != m_cells.end()) && cell->second.empty())
+        m_cells.erase(cell);
+}
+
+} // namespace sf
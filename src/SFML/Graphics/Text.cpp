@@ -47,6 +47,18 @@ namespace
         vertices.append(sf::Vertex(sf::Vector2f(lineLength + outlineThickness, bottom + outlineThickness), color, sf::Vector2f(1, 1)));
     }
 
+    // Get the color to give to the vertices of a text, multiplied by its alpha if the font uses premultiplied alpha
+    sf::Color getVertexColor(const sf::Color& color, const sf::Font* font)
+    {
+        if (!font || !font->isPremultipliedAlpha())
+            return color;
+
+        return sf::Color(static_cast<sf::Uint8>((color.r * color.a + 127) / 255),
+                         static_cast<sf::Uint8>((color.g * color.a + 127) / 255),
+                         static_cast<sf::Uint8>((color.b * color.a + 127) / 255),
+                         color.a);
+    }
+
     // Add a glyph quad to the vertex array
     void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear, float outlineThickness = 0)
     {
@@ -76,20 +88,23 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 Text::Text() :
-m_string             (),
-m_font               (NULL),
-m_characterSize      (30),
-m_letterSpacingFactor(1.f),
-m_lineSpacingFactor  (1.f),
-m_style              (Regular),
-m_fillColor          (255, 255, 255),
-m_outlineColor       (0, 0, 0),
-m_outlineThickness   (0),
-m_vertices           (Triangles),
-m_outlineVertices    (Triangles),
-m_bounds             (),
-m_geometryNeedUpdate (false),
-m_fontTextureId      (0)
+m_string                (),
+m_font                  (NULL),
+m_characterSize         (30),
+m_letterSpacingFactor   (1.f),
+m_lineSpacingFactor     (1.f),
+m_style                 (Regular),
+m_fillColor             (255, 255, 255),
+m_outlineColor          (0, 0, 0),
+m_outlineThickness      (0),
+m_vertices              (Triangles),
+m_outlineVertices       (Triangles),
+m_bounds                (),
+m_geometryNeedUpdate    (false),
+m_fontTextureId         (0),
+m_frozen                (false),
+m_frozenBuffer          (Triangles, VertexBuffer::Static),
+m_frozenBufferNeedUpdate(false)
 {
 
 }
@@ -97,20 +112,23 @@ m_fontTextureId      (0)
 
 ////////////////////////////////////////////////////////////
 Text::Text(const String& string, const Font& font, unsigned int characterSize) :
-m_string             (string),
-m_font               (&font),
-m_characterSize      (characterSize),
-m_letterSpacingFactor(1.f),
-m_lineSpacingFactor  (1.f),
-m_style              (Regular),
-m_fillColor          (255, 255, 255),
-m_outlineColor       (0, 0, 0),
-m_outlineThickness   (0),
-m_vertices           (Triangles),
-m_outlineVertices    (Triangles),
-m_bounds             (),
-m_geometryNeedUpdate (true),
-m_fontTextureId      (0)
+m_string                (string),
+m_font                  (&font),
+m_characterSize         (characterSize),
+m_letterSpacingFactor   (1.f),
+m_lineSpacingFactor     (1.f),
+m_style                 (Regular),
+m_fillColor             (255, 255, 255),
+m_outlineColor          (0, 0, 0),
+m_outlineThickness      (0),
+m_vertices              (Triangles),
+m_outlineVertices       (Triangles),
+m_bounds                (),
+m_geometryNeedUpdate    (true),
+m_fontTextureId         (0),
+m_frozen                (false),
+m_frozenBuffer          (Triangles, VertexBuffer::Static),
+m_frozenBufferNeedUpdate(false)
 {
 
 }
@@ -200,8 +218,11 @@ void Text::setFillColor(const Color& color)
         // (if geometry is updated anyway, we can skip this step)
         if (!m_geometryNeedUpdate)
         {
+            Color vertexColor = getVertexColor(m_fillColor, m_font);
             for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
-                m_vertices[i].color = m_fillColor;
+                m_vertices[i].color = vertexColor;
+
+            m_frozenBufferNeedUpdate = true;
         }
     }
 }
@@ -218,8 +239,11 @@ void Text::setOutlineColor(const Color& color)
         // (if geometry is updated anyway, we can skip this step)
         if (!m_geometryNeedUpdate)
         {
+            Color vertexColor = getVertexColor(m_outlineColor, m_font);
             for (std::size_t i = 0; i < m_outlineVertices.getVertexCount(); ++i)
-                m_outlineVertices[i].color = m_outlineColor;
+                m_outlineVertices[i].color = vertexColor;
+
+            m_frozenBufferNeedUpdate = true;
         }
     }
 }
@@ -236,6 +260,26 @@ void Text::setOutlineThickness(float thickness)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::setFrozen(bool frozen)
+{
+    if (frozen != m_frozen)
+    {
+        m_frozen = frozen;
+
+        // The geometry is rebuilt with the texture id that matches the new mode
+        m_geometryNeedUpdate = true;
+
+        // Release the buffer of a text that is no longer frozen
+        if (!m_frozen)
+        {
+            VertexBuffer emptyBuffer(Triangles, VertexBuffer::Static);
+            m_frozenBuffer.swap(emptyBuffer);
+        }
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 const String& Text::getString() const
 {
@@ -306,6 +350,13 @@ float Text::getOutlineThickness() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool Text::isFrozen() const
+{
+    return m_frozen;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2f Text::findCharacterPos(std::size_t index) const
 {
@@ -380,6 +431,23 @@ void Text::draw(RenderTarget& target, RenderStates states) const
         states.transform *= getTransform();
         states.texture = &m_font->getTexture(m_characterSize);
 
+        // Glyphs rendered with premultiplied alpha must be blended accordingly
+        if (m_font->isPremultipliedAlpha() && (states.blendMode == BlendAlpha))
+            states.blendMode = BlendPremultipliedAlpha;
+
+        // Frozen texts draw their outline and fill from a single static buffer
+        if (m_frozen && VertexBuffer::isAvailable())
+        {
+            if (m_frozenBufferNeedUpdate)
+                updateFrozenBuffer();
+
+            if (m_frozenBuffer.getVertexCount() > 0)
+            {
+                target.draw(m_frozenBuffer, states);
+                return;
+            }
+        }
+
         // Only draw the outline if there is something to draw
         if (m_outlineThickness != 0)
             target.draw(m_outlineVertices, states);
@@ -395,15 +463,21 @@ void Text::ensureGeometryUpdate() const
     if (!m_font)
         return;
 
+    // A frozen text ignores glyph uploads to its font page, the texture coordinates
+    // of its glyphs only become invalid when the page texture is recreated
+    const Texture& texture = m_font->getTexture(m_characterSize);
+    Uint64 textureId = m_frozen ? texture.m_storageId : texture.m_cacheId;
+
     // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
+    if (!m_geometryNeedUpdate && textureId == m_fontTextureId)
         return;
 
     // Save the current fonts texture id
-    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    m_fontTextureId = textureId;
 
     // Mark geometry as updated
     m_geometryNeedUpdate = false;
+    m_frozenBufferNeedUpdate = true;
 
     // Clear the previous geometry
     m_vertices.clear();
@@ -421,6 +495,8 @@ void Text::ensureGeometryUpdate() const
     float italicShear        = (m_style & Italic) ? 0.209f : 0.f; // 12 degrees in radians
     float underlineOffset    = m_font->getUnderlinePosition(m_characterSize);
     float underlineThickness = m_font->getUnderlineThickness(m_characterSize);
+    Color fillColor          = getVertexColor(m_fillColor, m_font);
+    Color outlineColor       = getVertexColor(m_outlineColor, m_font);
 
     // Compute the location of the strike through dynamically
     // We use the center point of the lowercase 'x' glyph as the reference
@@ -456,19 +532,19 @@ void Text::ensureGeometryUpdate() const
         // If we're using the underlined style and there's a new line, draw a line
         if (isUnderlined && (curChar == L'\n' && prevChar != L'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+            addLine(m_vertices, x, y, fillColor, underlineOffset, underlineThickness);
 
             if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+                addLine(m_outlineVertices, x, y, outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
         }
 
         // If we're using the strike through style and there's a new line, draw a line across all characters
         if (isStrikeThrough && (curChar == L'\n' && prevChar != L'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+            addLine(m_vertices, x, y, fillColor, strikeThroughOffset, underlineThickness);
 
             if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+                addLine(m_outlineVertices, x, y, outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
         }
 
         prevChar = curChar;
@@ -506,7 +582,7 @@ void Text::ensureGeometryUpdate() const
             float bottom = glyph.bounds.top  + glyph.bounds.height;
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear, m_outlineThickness);
+            addGlyphQuad(m_outlineVertices, Vector2f(x, y), outlineColor, glyph, italicShear, m_outlineThickness);
 
             // Update the current bounds with the outlined glyph bounds
             minX = std::min(minX, x + left   - italicShear * bottom - m_outlineThickness);
@@ -519,7 +595,7 @@ void Text::ensureGeometryUpdate() const
         const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        addGlyphQuad(m_vertices, Vector2f(x, y), fillColor, glyph, italicShear);
 
         // Update the current bounds with the non outlined glyph bounds
         if (m_outlineThickness == 0)
@@ -542,19 +618,19 @@ void Text::ensureGeometryUpdate() const
     // If we're using the underlined style, add the last line
     if (isUnderlined && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+        addLine(m_vertices, x, y, fillColor, underlineOffset, underlineThickness);
 
         if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+            addLine(m_outlineVertices, x, y, outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
     }
 
     // If we're using the strike through style, add the last line across all characters
     if (isStrikeThrough && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+        addLine(m_vertices, x, y, fillColor, strikeThroughOffset, underlineThickness);
 
         if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+            addLine(m_outlineVertices, x, y, outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
     }
 
     // Update the bounding rectangle
@@ -564,4 +640,29 @@ void Text::ensureGeometryUpdate() const
     m_bounds.height = maxY - minY;
 }
 
+
+////////////////////////////////////////////////////////////
+void Text::updateFrozenBuffer() const
+{
+    m_frozenBufferNeedUpdate = false;
+
+    // The outline is stored first so that the fill is drawn over it
+    std::size_t outlineCount = (m_outlineThickness != 0) ? m_outlineVertices.getVertexCount() : 0;
+    std::size_t fillCount = m_vertices.getVertexCount();
+    std::size_t vertexCount = outlineCount + fillCount;
+
+    if (m_frozenBuffer.getVertexCount() != vertexCount)
+    {
+        if (!m_frozenBuffer.create(vertexCount))
+            return;
+    }
+
+    bool updated = ((outlineCount == 0) || m_frozenBuffer.update(&m_outlineVertices[0], outlineCount, 0)) &&
+                   ((fillCount == 0) || m_frozenBuffer.update(&m_vertices[0], fillCount, static_cast<unsigned int>(outlineCount)));
+
+    // Fall back to drawing from memory if the upload failed
+    if (!updated)
+        m_frozenBuffer.create(0);
+}
+
 } // namespace sf
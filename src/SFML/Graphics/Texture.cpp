@@ -60,32 +60,36 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 Texture::Texture() :
-m_size         (0, 0),
-m_actualSize   (0, 0),
-m_texture      (0),
-m_isSmooth     (false),
-m_sRgb         (false),
-m_isRepeated   (false),
-m_pixelsFlipped(false),
-m_fboAttachment(false),
-m_hasMipmap    (false),
-m_cacheId      (getUniqueId())
+m_size              (0, 0),
+m_actualSize        (0, 0),
+m_texture           (0),
+m_isSmooth          (false),
+m_sRgb              (false),
+m_isRepeated        (false),
+m_premultipliedAlpha(false),
+m_pixelsFlipped     (false),
+m_fboAttachment     (false),
+m_hasMipmap         (false),
+m_cacheId           (getUniqueId()),
+m_storageId         (getUniqueId())
 {
 }
 
 
 ////////////////////////////////////////////////////////////
 Texture::Texture(const Texture& copy) :
-m_size         (0, 0),
-m_actualSize   (0, 0),
-m_texture      (0),
-m_isSmooth     (copy.m_isSmooth),
-m_sRgb         (copy.m_sRgb),
-m_isRepeated   (copy.m_isRepeated),
-m_pixelsFlipped(false),
-m_fboAttachment(false),
-m_hasMipmap    (false),
-m_cacheId      (getUniqueId())
+m_size              (0, 0),
+m_actualSize        (0, 0),
+m_texture           (0),
+m_isSmooth          (copy.m_isSmooth),
+m_sRgb              (copy.m_sRgb),
+m_isRepeated        (copy.m_isRepeated),
+m_premultipliedAlpha(copy.m_premultipliedAlpha),
+m_pixelsFlipped     (false),
+m_fboAttachment     (false),
+m_hasMipmap         (false),
+m_cacheId           (getUniqueId()),
+m_storageId         (getUniqueId())
 {
     if (copy.m_texture)
     {
@@ -207,6 +211,7 @@ bool Texture::create(unsigned int width, unsigned int height)
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
     m_cacheId = getUniqueId();
+    m_storageId = getUniqueId();
 
     m_hasMipmap = false;
 
@@ -272,6 +277,16 @@ bool Texture::loadFromImage(const Image& image, const IntRect& area)
         if (rectangle.left + rectangle.width > width)  rectangle.width  = width - rectangle.left;
         if (rectangle.top + rectangle.height > height) rectangle.height = height - rectangle.top;
 
+        // Pixels that must be converted are extracted first, so that they are uploaded at once
+        if (m_premultipliedAlpha)
+        {
+            Image subImage;
+            subImage.create(rectangle.width, rectangle.height);
+            subImage.copy(image, 0, 0, rectangle);
+
+            return loadFromImage(subImage);
+        }
+
         // Create the texture and upload the pixels
         if (create(rectangle.width, rectangle.height))
         {
@@ -411,6 +426,15 @@ void Texture::update(const Uint8* pixels, unsigned int width, unsigned int heigh
 
     if (pixels && m_texture)
     {
+        // Convert the pixels to premultiplied alpha before uploading them
+        Image converted;
+        if (m_premultipliedAlpha)
+        {
+            converted.create(width, height, pixels);
+            converted.premultiplyAlpha();
+            pixels = converted.getPixelsPtr();
+        }
+
         TransientContextLock lock;
 
         // Make sure that the current texture binding will be preserved
@@ -686,6 +710,20 @@ bool Texture::isRepeated() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Texture::setPremultipliedAlpha(bool premultiplied)
+{
+    m_premultipliedAlpha = premultiplied;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::isPremultipliedAlpha() const
+{
+    return m_premultipliedAlpha;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Texture::generateMipmap()
 {
@@ -822,18 +860,21 @@ Texture& Texture::operator =(const Texture& right)
 ////////////////////////////////////////////////////////////
 void Texture::swap(Texture& right)
 {
-    std::swap(m_size,          right.m_size);
-    std::swap(m_actualSize,    right.m_actualSize);
-    std::swap(m_texture,       right.m_texture);
-    std::swap(m_isSmooth,      right.m_isSmooth);
-    std::swap(m_sRgb,          right.m_sRgb);
-    std::swap(m_isRepeated,    right.m_isRepeated);
-    std::swap(m_pixelsFlipped, right.m_pixelsFlipped);
-    std::swap(m_fboAttachment, right.m_fboAttachment);
-    std::swap(m_hasMipmap,     right.m_hasMipmap);
+    std::swap(m_size,               right.m_size);
+    std::swap(m_actualSize,         right.m_actualSize);
+    std::swap(m_texture,            right.m_texture);
+    std::swap(m_isSmooth,           right.m_isSmooth);
+    std::swap(m_sRgb,               right.m_sRgb);
+    std::swap(m_isRepeated,         right.m_isRepeated);
+    std::swap(m_premultipliedAlpha, right.m_premultipliedAlpha);
+    std::swap(m_pixelsFlipped,      right.m_pixelsFlipped);
+    std::swap(m_fboAttachment,      right.m_fboAttachment);
+    std::swap(m_hasMipmap,          right.m_hasMipmap);
 
     m_cacheId = getUniqueId();
     right.m_cacheId = getUniqueId();
+    m_storageId = getUniqueId();
+    right.m_storageId = getUniqueId();
 }
 
 
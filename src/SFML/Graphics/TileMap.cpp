@@ -0,0 +1,422 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TileMap.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/SpatialIndex.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+    // Number of vertices used by a tile
+    const std::size_t verticesPerTile = 6;
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+const unsigned int TileMap::EmptyTile = 0xFFFFFFFF;
+
+
+////////////////////////////////////////////////////////////
+TileMap::Chunk::Chunk() :
+width        (0),
+vertices     (),
+dirtyTiles   (),
+animatedTiles(),
+needUpload   (true)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::TileMap() :
+m_size      (0, 0),
+m_tileSize  (0, 0),
+m_chunkSize (0),
+m_chunkCount(0, 0),
+m_tiles     (),
+m_animations(),
+m_frame     (0),
+m_texture   (NULL),
+m_chunks    (),
+m_buffers   ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::create(const Vector2u& size, const Vector2u& tileSize, unsigned int chunkSize)
+{
+    assert(chunkSize > 0);
+
+    m_size = size;
+    m_tileSize = tileSize;
+    m_chunkSize = chunkSize;
+    m_chunkCount.x = (size.x + chunkSize - 1) / chunkSize;
+    m_chunkCount.y = (size.y + chunkSize - 1) / chunkSize;
+    m_tiles.assign(static_cast<std::size_t>(size.x) * size.y, EmptyTile);
+
+    m_chunks.clear();
+    m_buffers.clear();
+    m_chunks.resize(static_cast<std::size_t>(m_chunkCount.x) * m_chunkCount.y);
+
+    for (unsigned int y = 0; y < m_chunkCount.y; ++y)
+    {
+        for (unsigned int x = 0; x < m_chunkCount.x; ++x)
+        {
+            Chunk& chunk = m_chunks[y * m_chunkCount.x + x];
+
+            unsigned int height = std::min(chunkSize, size.y - y * chunkSize);
+            chunk.width = std::min(chunkSize, size.x - x * chunkSize);
+
+            // Empty tiles are degenerate triangles
+            chunk.vertices.assign(chunk.width * height * verticesPerTile, Vertex());
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTexture(const Texture& texture)
+{
+    m_texture = &texture;
+
+    // Texture coordinates depend on the number of tiles per row of the tileset
+    updateAllVertices();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* TileMap::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(unsigned int x, unsigned int y, unsigned int tile)
+{
+    assert((x < m_size.x) && (y < m_size.y));
+
+    unsigned int& current = m_tiles[static_cast<std::size_t>(y) * m_size.x + x];
+    if (current == tile)
+        return;
+
+    current = tile;
+    updateTileVertices(x, y);
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTiles(const unsigned int* tiles)
+{
+    std::copy(tiles, tiles + m_tiles.size(), m_tiles.begin());
+
+    updateAllVertices();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TileMap::getTile(unsigned int x, unsigned int y) const
+{
+    assert((x < m_size.x) && (y < m_size.y));
+
+    return m_tiles[static_cast<std::size_t>(y) * m_size.x + x];
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTileAnimation(unsigned int tile, unsigned int frameCount)
+{
+    assert(frameCount > 0);
+
+    if (frameCount > 1)
+        m_animations[tile] = frameCount;
+    else
+        m_animations.erase(tile);
+
+    // The texture coordinates of the tile depend on its animation
+    updateAllVertices();
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setAnimationFrame(unsigned int frame)
+{
+    if (frame == m_frame)
+        return;
+
+    m_frame = frame;
+
+    // Only the animated tiles have to be updated
+    for (unsigned int y = 0; y < m_chunkCount.y; ++y)
+    {
+        for (unsigned int x = 0; x < m_chunkCount.x; ++x)
+        {
+            const Chunk& chunk = m_chunks[y * m_chunkCount.x + x];
+
+            for (std::set<std::size_t>::const_iterator it = chunk.animatedTiles.begin(); it != chunk.animatedTiles.end(); ++it)
+                updateTileVertices(x * m_chunkSize + static_cast<unsigned int>(*it % chunk.width), y * m_chunkSize + static_cast<unsigned int>(*it / chunk.width));
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    return FloatRect(0.f, 0.f, static_cast<float>(m_size.x * m_tileSize.x), static_cast<float>(m_size.y * m_tileSize.y));
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getChunkCount() const
+{
+    return m_chunkCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TileMap::getChunkVertexCount(unsigned int x, unsigned int y) const
+{
+    assert((x < m_chunkCount.x) && (y < m_chunkCount.y));
+
+    return m_chunks[y * m_chunkCount.x + x].vertices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Vertex* TileMap::getChunkVertices(unsigned int x, unsigned int y) const
+{
+    assert((x < m_chunkCount.x) && (y < m_chunkCount.y));
+
+    return &m_chunks[y * m_chunkCount.x + x].vertices[0];
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect TileMap::getVisibleChunks(const View& view, const Transform& transform) const
+{
+    if (m_chunks.empty() || !m_tileSize.x || !m_tileSize.y)
+        return IntRect();
+
+    // Find the range of chunks that intersect the view, in local coordinates
+    Transform combined = transform * getTransform();
+    FloatRect area = combined.getInverse().transformRect(SpatialIndex::getViewBounds(view));
+
+    float chunkWidth = static_cast<float>(m_chunkSize * m_tileSize.x);
+    float chunkHeight = static_cast<float>(m_chunkSize * m_tileSize.y);
+
+    float left   = std::max(std::floor(area.left / chunkWidth), 0.f);
+    float top    = std::max(std::floor(area.top / chunkHeight), 0.f);
+    float right  = std::min(std::floor((area.left + area.width) / chunkWidth), static_cast<float>(m_chunkCount.x) - 1.f);
+    float bottom = std::min(std::floor((area.top + area.height) / chunkHeight), static_cast<float>(m_chunkCount.y) - 1.f);
+
+    if ((left > right) || (top > bottom))
+        return IntRect();
+
+    return IntRect(static_cast<int>(left), static_cast<int>(top), static_cast<int>(right - left) + 1, static_cast<int>(bottom - top) + 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, RenderStates states) const
+{
+    IntRect chunks = getVisibleChunks(target.getView(), states.transform);
+    if ((chunks.width <= 0) || (chunks.height <= 0))
+        return;
+
+    states.transform *= getTransform();
+    states.texture = m_texture;
+
+    bool useBuffers = VertexBuffer::isAvailable();
+
+    // The vertex buffers are only created when the map is drawn, so that maps can be built without a context
+    if (useBuffers && (m_buffers.size() != m_chunks.size()))
+    {
+        m_buffers.assign(m_chunks.size(), VertexBuffer(Triangles, VertexBuffer::Static));
+
+        for (std::vector<Chunk>::iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+        {
+            it->needUpload = true;
+            it->dirtyTiles.clear();
+        }
+    }
+
+    for (int y = chunks.top; y < chunks.top + chunks.height; ++y)
+    {
+        for (int x = chunks.left; x < chunks.left + chunks.width; ++x)
+        {
+            std::size_t index = static_cast<std::size_t>(y) * m_chunkCount.x + x;
+            Chunk& chunk = m_chunks[index];
+
+            if (useBuffers)
+            {
+                upload(chunk, m_buffers[index]);
+                target.draw(m_buffers[index], states);
+            }
+            else
+            {
+                target.draw(&chunk.vertices[0], chunk.vertices.size(), Triangles, states);
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::updateTileVertices(unsigned int x, unsigned int y)
+{
+    Chunk& chunk = m_chunks[(y / m_chunkSize) * m_chunkCount.x + x / m_chunkSize];
+    std::size_t index = (y % m_chunkSize) * chunk.width + x % m_chunkSize;
+    Vertex* vertices = &chunk.vertices[index * verticesPerTile];
+
+    unsigned int tile = m_tiles[static_cast<std::size_t>(y) * m_size.x + x];
+
+    // Only the changed tiles are uploaded, unless the whole chunk has to be; when many
+    // tiles changed, a single upload is cheaper than many small ones, and it also bounds
+    // the list for chunks that are animated while they are not drawn
+    if (!chunk.needUpload)
+    {
+        chunk.dirtyTiles.push_back(index);
+
+        if (chunk.dirtyTiles.size() * 4 > chunk.vertices.size() / verticesPerTile)
+        {
+            chunk.needUpload = true;
+            chunk.dirtyTiles.clear();
+        }
+    }
+
+    if (tile == EmptyTile)
+    {
+        std::fill(vertices, vertices + verticesPerTile, Vertex());
+        chunk.animatedTiles.erase(index);
+        return;
+    }
+
+    // Find the position of the tile in the tileset
+    unsigned int columns = 1;
+    if (m_texture && (m_texture->getSize().x >= m_tileSize.x) && m_tileSize.x)
+        columns = m_texture->getSize().x / m_tileSize.x;
+
+    float u = static_cast<float>((tile % columns) * m_tileSize.x);
+    float v = static_cast<float>((tile / columns) * m_tileSize.y);
+    float w = static_cast<float>(m_tileSize.x);
+    float h = static_cast<float>(m_tileSize.y);
+
+    float left = static_cast<float>(x * m_tileSize.x);
+    float top = static_cast<float>(y * m_tileSize.y);
+
+    // Animated tiles display the current frame, stored after the first one on the same row of the tileset
+    std::map<unsigned int, unsigned int>::const_iterator animation = m_animations.find(tile);
+    if (animation != m_animations.end())
+    {
+        u += static_cast<float>((m_frame % animation->second) * m_tileSize.x);
+        chunk.animatedTiles.insert(index);
+    }
+    else
+    {
+        chunk.animatedTiles.erase(index);
+    }
+
+    vertices[0] = Vertex(Vector2f(left,     top),     Vector2f(u,     v));
+    vertices[1] = Vertex(Vector2f(left + w, top),     Vector2f(u + w, v));
+    vertices[2] = Vertex(Vector2f(left,     top + h), Vector2f(u,     v + h));
+    vertices[3] = Vertex(Vector2f(left,     top + h), Vector2f(u,     v + h));
+    vertices[4] = Vertex(Vector2f(left + w, top),     Vector2f(u + w, v));
+    vertices[5] = Vertex(Vector2f(left + w, top + h), Vector2f(u + w, v + h));
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::updateAllVertices()
+{
+    // All the chunks are uploaded completely, changed tiles don't need to be tracked
+    for (std::vector<Chunk>::iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+    {
+        it->needUpload = true;
+        it->dirtyTiles.clear();
+    }
+
+    for (unsigned int y = 0; y < m_size.y; ++y)
+        for (unsigned int x = 0; x < m_size.x; ++x)
+            updateTileVertices(x, y);
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::upload(Chunk& chunk, VertexBuffer& buffer)
+{
+    if (chunk.needUpload || (buffer.getVertexCount() != chunk.vertices.size()))
+    {
+        // Upload the whole chunk
+        if ((buffer.getVertexCount() == chunk.vertices.size()) || buffer.create(chunk.vertices.size()))
+            buffer.update(&chunk.vertices[0]);
+    }
+    else
+    {
+        // Only upload the tiles that changed
+        for (std::vector<std::size_t>::const_iterator it = chunk.dirtyTiles.begin(); it != chunk.dirtyTiles.end(); ++it)
+        {
+            std::size_t offset = *it * verticesPerTile;
+            buffer.update(&chunk.vertices[offset], verticesPerTile, static_cast<unsigned int>(offset));
+        }
+    }
+
+    chunk.needUpload = false;
+    chunk.dirtyTiles.clear();
+}
+
+} // namespace sf
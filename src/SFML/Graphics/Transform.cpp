@@ -26,6 +26,8 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/SIMD.hpp>
 #include <cmath>
 
 
@@ -138,6 +140,83 @@ FloatRect Transform::transformRect(const FloatRect& rectangle) const
 }
 
 
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vertex* input, Vertex* output, std::size_t count) const
+{
+    const float* m = m_matrix;
+    std::size_t i = 0;
+
+#if defined(SFML_SIMD_SSE2)
+
+    // Two vertices are transformed at once: their positions are loaded
+    // into a single register as (x0, y0, x1, y1)
+    const __m128 columnX     = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+    const __m128 columnY     = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+    const __m128 translation = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 positions = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&input[i].position));
+        positions = _mm_loadh_pi(positions, reinterpret_cast<const __m64*>(&input[i + 1].position));
+
+        __m128 x = _mm_shuffle_ps(positions, positions, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 y = _mm_shuffle_ps(positions, positions, _MM_SHUFFLE(3, 3, 1, 1));
+        __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, columnX), _mm_mul_ps(y, columnY)), translation);
+
+        output[i].color         = input[i].color;
+        output[i].texCoords     = input[i].texCoords;
+        output[i + 1].color     = input[i + 1].color;
+        output[i + 1].texCoords = input[i + 1].texCoords;
+
+        _mm_storel_pi(reinterpret_cast<__m64*>(&output[i].position), result);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&output[i + 1].position), result);
+    }
+
+#elif defined(SFML_SIMD_NEON)
+
+    // Two vertices are transformed at once: their positions are loaded
+    // into a single register as (x0, y0, x1, y1)
+    const float32x2_t columnX2     = {m[0], m[1]};
+    const float32x2_t columnY2     = {m[4], m[5]};
+    const float32x2_t translation2 = {m[12], m[13]};
+    const float32x4_t columnX      = vcombine_f32(columnX2, columnX2);
+    const float32x4_t columnY      = vcombine_f32(columnY2, columnY2);
+    const float32x4_t translation  = vcombine_f32(translation2, translation2);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        float32x2_t first  = vld1_f32(&input[i].position.x);
+        float32x2_t second = vld1_f32(&input[i + 1].position.x);
+
+        float32x4_t x = vcombine_f32(vdup_lane_f32(first, 0), vdup_lane_f32(second, 0));
+        float32x4_t y = vcombine_f32(vdup_lane_f32(first, 1), vdup_lane_f32(second, 1));
+        float32x4_t result = vaddq_f32(vaddq_f32(vmulq_f32(x, columnX), vmulq_f32(y, columnY)), translation);
+
+        output[i].color         = input[i].color;
+        output[i].texCoords     = input[i].texCoords;
+        output[i + 1].color     = input[i + 1].color;
+        output[i + 1].texCoords = input[i + 1].texCoords;
+
+        vst1_f32(&output[i].position.x, vget_low_f32(result));
+        vst1_f32(&output[i + 1].position.x, vget_high_f32(result));
+    }
+
+#endif
+
+    // Transform the remaining vertices one by one
+    for (; i < count; ++i)
+    {
+        float x = input[i].position.x;
+        float y = input[i].position.y;
+
+        output[i].position.x = m[0] * x + m[4] * y + m[12];
+        output[i].position.y = m[1] * x + m[5] * y + m[13];
+        output[i].color      = input[i].color;
+        output[i].texCoords  = input[i].texCoords;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 Transform& Transform::combine(const Transform& transform)
 {
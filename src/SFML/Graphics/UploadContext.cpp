@@ -0,0 +1,269 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/UploadContext.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Window/Context.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Err.hpp>
+#include <vector>
+
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+    #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#endif
+
+#ifndef GL_ALREADY_SIGNALED
+    #define GL_ALREADY_SIGNALED 0x911A
+#endif
+
+#ifndef GL_CONDITION_SATISFIED
+    #define GL_CONDITION_SATISFIED 0x911C
+#endif
+
+#ifndef GL_WAIT_FAILED
+    #define GL_WAIT_FAILED 0x911D
+#endif
+
+
+namespace
+{
+    // Protects the pool of contexts and the loading of the entry points
+    sf::Mutex mutex;
+
+    // OpenGL 3.2 / ARB_sync entry points, the extension loader of sfml-graphics doesn't provide them
+    struct Functions
+    {
+        typedef GLsync (GLAPIENTRY *FenceSync)(GLenum, GLbitfield);
+        typedef GLenum (GLAPIENTRY *ClientWaitSync)(GLsync, GLbitfield, GLuint64);
+        typedef void   (GLAPIENTRY *DeleteSync)(GLsync);
+
+        FenceSync      fenceSync;
+        ClientWaitSync clientWaitSync;
+        DeleteSync     deleteSync;
+    };
+
+    Functions gl;
+
+    // Load all the entry points used by fences, returns false if any of them is missing
+    bool loadFunctions()
+    {
+        sf::Lock lock(mutex);
+
+        static bool loaded = false;
+        static bool result = false;
+
+        if (!loaded)
+        {
+            loaded = true;
+            gl.fenceSync      = reinterpret_cast<Functions::FenceSync>(sf::Context::getFunction("glFenceSync"));
+            gl.clientWaitSync = reinterpret_cast<Functions::ClientWaitSync>(sf::Context::getFunction("glClientWaitSync"));
+            gl.deleteSync     = reinterpret_cast<Functions::DeleteSync>(sf::Context::getFunction("glDeleteSync"));
+            result = gl.fenceSync && gl.clientWaitSync && gl.deleteSync;
+        }
+
+        return result;
+    }
+
+    // Contexts that are not used by any upload context at the moment; they are only
+    // destroyed explicitly, since a context can't be safely destroyed during static
+    // destruction, and the pool is bounded so that it doesn't keep more contexts
+    // than typical numbers of workers use
+    const std::size_t maxPoolSize = 4;
+    std::vector<sf::Context*> pool;
+
+    // Wait on a sync object for the given number of nanoseconds, returns true if it is signaled
+    bool clientWaitSync(void* sync, GLuint64 timeout)
+    {
+        GLenum result = GL_WAIT_FAILED;
+        glCheck(result = gl.clientWaitSync(static_cast<GLsync>(sync), 0, timeout));
+
+        if (result == GL_WAIT_FAILED)
+        {
+            // Don't leave the caller waiting forever on a fence that can't be checked
+            sf::err() << "Failed to wait for an upload fence, assuming the uploads are complete" << std::endl;
+            return true;
+        }
+
+        return (result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED);
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+UploadContext::Fence::Fence() :
+m_sync(NULL)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UploadContext::Fence::~Fence()
+{
+    reset();
+}
+
+
+////////////////////////////////////////////////////////////
+bool UploadContext::Fence::isReady() const
+{
+    return wait(Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+bool UploadContext::Fence::wait(Time timeout) const
+{
+    if (!m_sync)
+        return true;
+
+    TransientContextLock lock;
+
+    GLuint64 nanoseconds = (timeout > Time::Zero) ? static_cast<GLuint64>(timeout.asMicroseconds()) * 1000 : 0;
+
+    if (!clientWaitSync(m_sync, nanoseconds))
+        return false;
+
+    // The sync object is no longer needed once it has been signaled
+    reset();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void UploadContext::Fence::reset() const
+{
+    if (!m_sync)
+        return;
+
+    TransientContextLock lock;
+
+    glCheck(gl.deleteSync(static_cast<GLsync>(m_sync)));
+    m_sync = NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+UploadContext::UploadContext() :
+m_context(NULL)
+{
+    {
+        Lock lock(mutex);
+
+        if (!pool.empty())
+        {
+            m_context = pool.back();
+            pool.pop_back();
+        }
+    }
+
+    if (m_context)
+    {
+        if (!m_context->setActive(true))
+            err() << "Failed to activate the upload context" << std::endl;
+    }
+    else
+    {
+        // A new context is created active on the calling thread
+        m_context = new Context;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+UploadContext::~UploadContext()
+{
+    // Make sure the commands reach the GPU before another thread relies on them
+    glCheck(glFlush());
+
+    if (!m_context->setActive(false))
+        err() << "Failed to deactivate the upload context" << std::endl;
+
+    {
+        Lock lock(mutex);
+
+        if (pool.size() < maxPoolSize)
+        {
+            pool.push_back(m_context);
+            return;
+        }
+    }
+
+    delete m_context;
+}
+
+
+////////////////////////////////////////////////////////////
+void UploadContext::submit(Fence& fence)
+{
+    fence.reset();
+
+    if (loadFunctions())
+    {
+        GLsync sync = NULL;
+        glCheck(sync = gl.fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+        // The fence must be flushed, otherwise other contexts could wait on it forever
+        glCheck(glFlush());
+
+        fence.m_sync = sync;
+    }
+    else
+    {
+        glCheck(glFinish());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool UploadContext::isFenceAvailable()
+{
+    TransientContextLock lock;
+
+    return loadFunctions();
+}
+
+
+////////////////////////////////////////////////////////////
+void UploadContext::releaseUnusedContexts()
+{
+    std::vector<Context*> contexts;
+
+    {
+        Lock lock(mutex);
+        contexts.swap(pool);
+    }
+
+    for (std::vector<Context*>::iterator it = contexts.begin(); it != contexts.end(); ++it)
+        delete *it;
+}
+
+} // namespace sf
@@ -27,22 +27,105 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/SIMD.hpp>
+#include <algorithm>
+
+
+namespace
+{
+    // Compute the minimum and maximum coordinates of a non-empty array of vertices
+    void computeBounds(const sf::Vertex* vertices, std::size_t count, sf::Vector2f& minimum, sf::Vector2f& maximum)
+    {
+        std::size_t i = 0;
+
+        minimum = vertices[0].position;
+        maximum = vertices[0].position;
+
+#if defined(SFML_SIMD_SSE2)
+
+        // Reduce two vertices at once, with their positions loaded as (x0, y0, x1, y1)
+        __m128 low = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&vertices[0].position));
+        low = _mm_movelh_ps(low, low);
+        __m128 high = low;
+
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128 positions = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&vertices[i].position));
+            positions = _mm_loadh_pi(positions, reinterpret_cast<const __m64*>(&vertices[i + 1].position));
+
+            low = _mm_min_ps(low, positions);
+            high = _mm_max_ps(high, positions);
+        }
+
+        low = _mm_min_ps(low, _mm_movehl_ps(low, low));
+        high = _mm_max_ps(high, _mm_movehl_ps(high, high));
+
+        _mm_storel_pi(reinterpret_cast<__m64*>(&minimum), low);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&maximum), high);
+
+#elif defined(SFML_SIMD_NEON)
+
+        // Reduce two vertices at once, with their positions loaded as (x0, y0, x1, y1)
+        float32x2_t first = vld1_f32(&vertices[0].position.x);
+        float32x4_t low = vcombine_f32(first, first);
+        float32x4_t high = low;
+
+        for (; i + 2 <= count; i += 2)
+        {
+            float32x4_t positions = vcombine_f32(vld1_f32(&vertices[i].position.x), vld1_f32(&vertices[i + 1].position.x));
+
+            low = vminq_f32(low, positions);
+            high = vmaxq_f32(high, positions);
+        }
+
+        vst1_f32(&minimum.x, vmin_f32(vget_low_f32(low), vget_high_f32(low)));
+        vst1_f32(&maximum.x, vmax_f32(vget_low_f32(high), vget_high_f32(high)));
+
+#endif
+
+        // Reduce the remaining vertices one by one
+        for (; i < count; ++i)
+        {
+            const sf::Vector2f& position = vertices[i].position;
+
+            minimum.x = std::min(minimum.x, position.x);
+            minimum.y = std::min(minimum.y, position.y);
+            maximum.x = std::max(maximum.x, position.x);
+            maximum.y = std::max(maximum.y, position.y);
+        }
+    }
+
+    // Extend bounds so that they contain a point
+    void extendBounds(const sf::Vector2f& point, sf::Vector2f& minimum, sf::Vector2f& maximum)
+    {
+        minimum.x = std::min(minimum.x, point.x);
+        minimum.y = std::min(minimum.y, point.y);
+        maximum.x = std::max(maximum.x, point.x);
+        maximum.y = std::max(maximum.y, point.y);
+    }
+}
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
 VertexArray::VertexArray() :
-m_vertices     (),
-m_primitiveType(Points)
+m_vertices        (),
+m_primitiveType   (Points),
+m_boundsMin       (),
+m_boundsMax       (),
+m_boundsNeedUpdate(false)
 {
 }
 
 
 ////////////////////////////////////////////////////////////
 VertexArray::VertexArray(PrimitiveType type, std::size_t vertexCount) :
-m_vertices     (vertexCount),
-m_primitiveType(type)
+m_vertices        (vertexCount),
+m_primitiveType   (type),
+m_boundsMin       (),
+m_boundsMax       (),
+m_boundsNeedUpdate(false)
 {
 }
 
@@ -57,6 +140,9 @@ std::size_t VertexArray::getVertexCount() const
 ////////////////////////////////////////////////////////////
 Vertex& VertexArray::operator [](std::size_t index)
 {
+    // The vertex may be modified through the returned reference
+    m_boundsNeedUpdate = true;
+
     return m_vertices[index];
 }
 
@@ -72,12 +158,27 @@ const Vertex& VertexArray::operator [](std::size_t index) const
 void VertexArray::clear()
 {
     m_vertices.clear();
+    m_boundsNeedUpdate = false;
 }
 
 
 ////////////////////////////////////////////////////////////
 void VertexArray::resize(std::size_t vertexCount)
 {
+    if (vertexCount < m_vertices.size())
+    {
+        // Removed vertices may have been on the bounds
+        m_boundsNeedUpdate = (vertexCount > 0);
+    }
+    else if ((vertexCount > m_vertices.size()) && !m_boundsNeedUpdate)
+    {
+        // New vertices are all at the origin
+        if (m_vertices.empty())
+            m_boundsMin = m_boundsMax = Vector2f();
+        else
+            extendBounds(Vector2f(), m_boundsMin, m_boundsMax);
+    }
+
     m_vertices.resize(vertexCount);
 }
 
@@ -85,6 +186,14 @@ void VertexArray::resize(std::size_t vertexCount)
 ////////////////////////////////////////////////////////////
 void VertexArray::append(const Vertex& vertex)
 {
+    if (!m_boundsNeedUpdate)
+    {
+        if (m_vertices.empty())
+            m_boundsMin = m_boundsMax = vertex.position;
+        else
+            extendBounds(vertex.position, m_boundsMin, m_boundsMax);
+    }
+
     m_vertices.push_back(vertex);
 }
 
@@ -106,37 +215,19 @@ PrimitiveType VertexArray::getPrimitiveType() const
 ////////////////////////////////////////////////////////////
 FloatRect VertexArray::getBounds() const
 {
-    if (!m_vertices.empty())
-    {
-        float left   = m_vertices[0].position.x;
-        float top    = m_vertices[0].position.y;
-        float right  = m_vertices[0].position.x;
-        float bottom = m_vertices[0].position.y;
-
-        for (std::size_t i = 1; i < m_vertices.size(); ++i)
-        {
-            Vector2f position = m_vertices[i].position;
-
-            // Update left and right
-            if (position.x < left)
-                left = position.x;
-            else if (position.x > right)
-                right = position.x;
-
-            // Update top and bottom
-            if (position.y < top)
-                top = position.y;
-            else if (position.y > bottom)
-                bottom = position.y;
-        }
-
-        return FloatRect(left, top, right - left, bottom - top);
-    }
-    else
+    if (m_vertices.empty())
     {
         // Array is empty
         return FloatRect();
     }
+
+    if (m_boundsNeedUpdate)
+    {
+        computeBounds(&m_vertices[0], m_vertices.size(), m_boundsMin, m_boundsMax);
+        m_boundsNeedUpdate = false;
+    }
+
+    return FloatRect(m_boundsMin.x, m_boundsMin.y, m_boundsMax.x - m_boundsMin.x, m_boundsMax.y - m_boundsMin.y);
 }
 
 
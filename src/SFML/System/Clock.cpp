@@ -60,4 +60,11 @@ Time Clock::restart()
     return elapsed;
 }
 
+
+////////////////////////////////////////////////////////////
+Time Clock::getCurrentTime()
+{
+    return priv::ClockImpl::getCurrentTime();
+}
+
 } // namespace sf
@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/FramePacer.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <algorithm>
+
+
+namespace
+{
+    // Initial margin kept before a deadline, until the precision of sleep has been measured
+    const sf::Int64 initialSleepMargin = 2000;
+
+    // Smallest margin ever kept, to absorb the cost of waking up
+    const sf::Int64 minimumSleepMargin = 100;
+
+    // The margin drops by 1/16th of the distance to the last measured overshoot after
+    // every sleep, so that a single slow wake-up doesn't make the pacer spin for long
+    const sf::Int64 sleepMarginDecay = 16;
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+FramePacer::FramePacer() :
+m_clock      (),
+m_frameTime  (Time::Zero),
+m_deadline   (Time::Zero),
+m_frameStart (Time::Zero),
+m_sleepMargin(microseconds(initialSleepMargin)),
+m_spinEnabled(true),
+m_statistics ()
+{
+    resetStatistics();
+}
+
+
+////////////////////////////////////////////////////////////
+FramePacer::FramePacer(Time frameTime) :
+m_clock      (),
+m_frameTime  (frameTime),
+m_deadline   (frameTime),
+m_frameStart (Time::Zero),
+m_sleepMargin(microseconds(initialSleepMargin)),
+m_spinEnabled(true),
+m_statistics ()
+{
+    resetStatistics();
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::setFrameTime(Time frameTime)
+{
+    m_frameTime = std::max(frameTime, Time::Zero);
+    restart();
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::getFrameTime() const
+{
+    return m_frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::setSpinEnabled(bool enabled)
+{
+    m_spinEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::getSleepMargin() const
+{
+    return m_sleepMargin;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::restart()
+{
+    m_clock.restart();
+    m_frameStart = Time::Zero;
+    m_deadline = m_frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::wait()
+{
+    Time now = m_clock.getElapsedTime();
+    bool missed = false;
+
+    if (m_frameTime != Time::Zero)
+    {
+        if (now < m_deadline)
+        {
+            waitUntil(m_deadline);
+            now = m_clock.getElapsedTime();
+        }
+        else
+        {
+            missed = true;
+        }
+
+        // Deadlines are cumulative so that the errors of each frame don't add up; when
+        // the loop falls behind by more than a frame, give up on the lost frames
+        if (now - m_deadline >= m_frameTime)
+            m_deadline = now + m_frameTime;
+        else
+            m_deadline += m_frameTime;
+    }
+
+    Time frameTime = now - m_frameStart;
+    m_frameStart = now;
+
+    recordFrame(frameTime, missed);
+
+    return frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+const FramePacer::Statistics& FramePacer::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::resetStatistics()
+{
+    m_statistics.frameCount = 0;
+    m_statistics.missedDeadlineCount = 0;
+    m_statistics.minFrameTime = Time::Zero;
+    m_statistics.maxFrameTime = Time::Zero;
+    m_statistics.totalFrameTime = Time::Zero;
+    std::fill(m_statistics.histogram, m_statistics.histogram + HistogramSize, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::waitUntil(Time deadline)
+{
+    // Sleep while the deadline is far enough, and measure how late sleep wakes us up
+    Time remaining = deadline - m_clock.getElapsedTime();
+    if (remaining > m_sleepMargin)
+    {
+        Time requested = remaining - m_sleepMargin;
+        Time start = m_clock.getElapsedTime();
+        sleep(requested);
+        Int64 overshoot = (m_clock.getElapsedTime() - start - requested).asMicroseconds();
+
+        // Follow longer overshoots immediately, and shorter ones slowly
+        Int64 margin = m_sleepMargin.asMicroseconds();
+        if (overshoot > margin)
+            margin = overshoot;
+        else
+            margin -= (margin - overshoot) / sleepMarginDecay;
+
+        m_sleepMargin = microseconds(std::max(margin, minimumSleepMargin));
+    }
+
+    // Spin for the rest of the frame
+    if (m_spinEnabled)
+    {
+        while (m_clock.getElapsedTime() < deadline)
+        {
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::recordFrame(Time frameTime, bool missed)
+{
+    if (m_statistics.frameCount == 0)
+    {
+        m_statistics.minFrameTime = frameTime;
+        m_statistics.maxFrameTime = frameTime;
+    }
+    else
+    {
+        m_statistics.minFrameTime = std::min(m_statistics.minFrameTime, frameTime);
+        m_statistics.maxFrameTime = std::max(m_statistics.maxFrameTime, frameTime);
+    }
+
+    m_statistics.frameCount++;
+    m_statistics.totalFrameTime += frameTime;
+
+    if (missed)
+        m_statistics.missedDeadlineCount++;
+
+    Int64 bucket = frameTime.asMicroseconds() / HistogramBucketWidth;
+    m_statistics.histogram[std::min(static_cast<std::size_t>(std::max(bucket, Int64(0))), HistogramSize - 1)]++;
+}
+
+} // namespace sf
@@ -57,6 +57,13 @@ void Mutex::lock()
 }
 
 
+////////////////////////////////////////////////////////////
+bool Mutex::tryLock()
+{
+    return m_mutexImpl->tryLock();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Mutex::unlock()
 {
@@ -58,6 +58,13 @@ void MutexImpl::lock()
 }
 
 
+////////////////////////////////////////////////////////////
+bool MutexImpl::tryLock()
+{
+    return pthread_mutex_trylock(&m_mutex) == 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 void MutexImpl::unlock()
 {
@@ -53,6 +53,13 @@ void MutexImpl::lock()
 }
 
 
+////////////////////////////////////////////////////////////
+bool MutexImpl::tryLock()
+{
+    return TryEnterCriticalSection(&m_mutex) != FALSE;
+}
+
+
 ////////////////////////////////////////////////////////////
 void MutexImpl::unlock()
 {
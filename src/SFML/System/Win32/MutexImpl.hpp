@@ -61,6 +61,14 @@ public:
     ////////////////////////////////////////////////////////////
     void lock();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Try to lock the mutex without blocking
+    ///
+    /// \return True if the mutex was locked, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool tryLock();
+
     ////////////////////////////////////////////////////////////
     /// \brief Unlock the mutex
     ///
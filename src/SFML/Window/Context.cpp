@@ -87,6 +87,20 @@ Uint64 Context::getActiveContextId()
 }
 
 
+////////////////////////////////////////////////////////////
+Uint64 Context::getLockAcquisitionCount()
+{
+    return priv::GlContext::getLockAcquisitionCount();
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 Context::getLockContentionCount()
+{
+    return priv::GlContext::getLockContentionCount();
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Context::isExtensionAvailable(const char* name)
 {
@@ -101,6 +115,20 @@ GlFunctionPointer Context::getFunction(const char* name)
 }
 
 
+////////////////////////////////////////////////////////////
+void Context::setHeadlessEnabled(bool enabled)
+{
+    priv::GlContext::setHeadlessEnabled(enabled);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Context::isHeadless()
+{
+    return priv::GlContext::isHeadless();
+}
+
+
 ////////////////////////////////////////////////////////////
 Context::Context(const ContextSettings& settings, unsigned int width, unsigned int height)
 {
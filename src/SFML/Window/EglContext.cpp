@@ -41,9 +41,98 @@
 
 #define SF_GLAD_EGL_IMPLEMENTATION
 #include <glad/egl.h>
+#include <cstring>
+
+#if !defined(SFML_OPENGL_ES)
+
+    // Desktop OpenGL only goes through EGL for headless rendering, on displays
+    // that don't need a window system; these come from client extensions that
+    // our EGL loader doesn't know about
+    #ifndef EGL_PLATFORM_DEVICE_EXT
+        #define EGL_PLATFORM_DEVICE_EXT 0x313F
+    #endif
+
+    #ifndef EGL_PLATFORM_SURFACELESS_MESA
+        #define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+    #endif
+
+    typedef EGLDisplay (GLAD_API_PTR *PFNEGLGETPLATFORMDISPLAYEXTPROC)(EGLenum platform, void* nativeDisplay, const EGLint* attribList);
+    typedef EGLBoolean (GLAD_API_PTR *PFNEGLQUERYDEVICESEXTPROC)(EGLint maxDevices, EGLDeviceEXT* devices, EGLint* deviceCount);
+
+#endif
 
 namespace
 {
+#if !defined(SFML_OPENGL_ES)
+
+    ////////////////////////////////////////////////////////////
+    bool hasExtension(const char* extensions, const char* name)
+    {
+        if (!extensions)
+            return false;
+
+        std::size_t length = std::strlen(name);
+
+        for (const char* found = std::strstr(extensions, name); found; found = std::strstr(found + length, name))
+        {
+            if (((found == extensions) || (found[-1] == ' ')) && ((found[length] == ' ') || (found[length] == '\0')))
+                return true;
+        }
+
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    EGLDisplay getHeadlessDisplay()
+    {
+        // Client extensions are queried without a display; this fails if they are not supported
+        const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        eglGetError();
+
+        PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+        if (!eglGetPlatformDisplayEXT || !hasExtension(extensions, "EGL_EXT_platform_base"))
+            return EGL_NO_DISPLAY;
+
+        // Mesa can render without any device or window system
+        if (hasExtension(extensions, "EGL_MESA_platform_surfaceless"))
+        {
+            EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+
+            if ((display != EGL_NO_DISPLAY) && eglInitialize(display, NULL, NULL))
+                return display;
+        }
+
+        // Other drivers expose their GPUs as devices
+        if (hasExtension(extensions, "EGL_EXT_platform_device"))
+        {
+            PFNEGLQUERYDEVICESEXTPROC eglQueryDevicesEXT = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+
+            EGLDeviceEXT devices[16];
+            EGLint deviceCount = 0;
+
+            if (eglQueryDevicesEXT && eglQueryDevicesEXT(16, devices, &deviceCount))
+            {
+                for (EGLint i = 0; i < deviceCount; ++i)
+                {
+                    EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, devices[i], NULL);
+
+                    if ((display != EGL_NO_DISPLAY) && eglInitialize(display, NULL, NULL))
+                        return display;
+                }
+            }
+        }
+
+        eglGetError();
+
+        return EGL_NO_DISPLAY;
+    }
+
+#endif
+
+
+    ////////////////////////////////////////////////////////////
     EGLDisplay getInitializedDisplay()
     {
 #if defined(SFML_SYSTEM_ANDROID)
@@ -60,6 +149,12 @@ namespace
 
         if (display == EGL_NO_DISPLAY)
         {
+#if !defined(SFML_OPENGL_ES)
+            display = getHeadlessDisplay();
+            if (display != EGL_NO_DISPLAY)
+                return display;
+#endif
+
             eglCheck(display = eglGetDisplay(EGL_DEFAULT_DISPLAY));
             eglCheck(eglInitialize(display, NULL, NULL));
         }
@@ -68,6 +163,28 @@ namespace
     }
 
 
+    ////////////////////////////////////////////////////////////
+    void bindApi()
+    {
+        // The rendering API is a per-thread state, which defaults to OpenGL ES
+#if !defined(SFML_OPENGL_ES)
+        eglCheck(eglBindAPI(EGL_OPENGL_API));
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    unsigned int getDefaultBitsPerPixel()
+    {
+#if defined(SFML_OPENGL_ES)
+        return sf::VideoMode::getDesktopMode().bitsPerPixel;
+#else
+        // Headless contexts don't have a desktop to match
+        return 32;
+#endif
+    }
+
+
     ////////////////////////////////////////////////////////////
     void ensureInit()
     {
@@ -104,21 +221,13 @@ m_config  (NULL)
     m_display = getInitializedDisplay();
 
     // Get the best EGL config matching the default video settings
-    m_config = getBestConfig(m_display, VideoMode::getDesktopMode().bitsPerPixel, ContextSettings());
+    m_config = getBestConfig(m_display, getDefaultBitsPerPixel(), ContextSettings());
     updateSettings();
 
-    // Note: The EGL specs say that attrib_list can be NULL when passed to eglCreatePbufferSurface,
-    // but this is resulting in a segfault. Bug in Android?
-    EGLint attrib_list[] = {
-        EGL_WIDTH, 1,
-        EGL_HEIGHT,1,
-        EGL_NONE
-    };
-
-    eglCheck(m_surface = eglCreatePbufferSurface(m_display, m_config, attrib_list));
+    createPbufferSurface(1, 1);
 
     // Create EGL context
-    createContext(shared);
+    createContext(shared, ContextSettings());
 }
 
 
@@ -149,7 +258,7 @@ m_config  (NULL)
     updateSettings();
 
     // Create EGL context
-    createContext(shared);
+    createContext(shared, settings);
 
 #if !defined(SFML_SYSTEM_ANDROID)
     // Create EGL surface (except on Android because the window is created
@@ -167,6 +276,18 @@ m_surface (EGL_NO_SURFACE),
 m_config  (NULL)
 {
     ensureInit();
+
+    // Get the initialized EGL display
+    m_display = getInitializedDisplay();
+
+    // Get the best EGL config matching the requested settings
+    m_config = getBestConfig(m_display, getDefaultBitsPerPixel(), settings);
+    updateSettings();
+
+    createPbufferSurface(width, height);
+
+    // Create EGL context
+    createContext(shared, settings);
 }
 
 
@@ -177,6 +298,8 @@ EglContext::~EglContext()
     cleanupUnsharedResources();
 
     // Deactivate the current context
+    bindApi();
+
     EGLContext currentContext = EGL_NO_CONTEXT;
     eglCheck(currentContext = eglGetCurrentContext());
 
@@ -216,6 +339,8 @@ bool EglContext::makeCurrent(bool current)
 
     EGLBoolean result = EGL_FALSE;
 
+    bindApi();
+
     if (current)
     {
         eglCheck(result = eglMakeCurrent(m_display, m_surface, m_surface, m_context));
@@ -245,13 +370,34 @@ void EglContext::setVerticalSyncEnabled(bool enabled)
 
 
 ////////////////////////////////////////////////////////////
-void EglContext::createContext(EglContext* shared)
+void EglContext::createContext(EglContext* shared, const ContextSettings& settings)
 {
+#if defined(SFML_OPENGL_ES)
+
     const EGLint contextVersion[] = {
         EGL_CONTEXT_CLIENT_VERSION, 1,
         EGL_NONE
     };
 
+#else
+
+    // Only request a specific version if it is more than the default 1.1
+    const bool versioned = (settings.majorVersion > 1) || ((settings.majorVersion == 1) && (settings.minorVersion > 1));
+    const bool core = (settings.attributeFlags & ContextSettings::Core) != 0;
+    const bool debug = (settings.attributeFlags & ContextSettings::Debug) != 0;
+
+    const EGLint contextVersion[] = {
+        EGL_CONTEXT_MAJOR_VERSION, static_cast<EGLint>(versioned ? settings.majorVersion : 1),
+        EGL_CONTEXT_MINOR_VERSION, static_cast<EGLint>(versioned ? settings.minorVersion : 0),
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, core ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+        EGL_CONTEXT_OPENGL_DEBUG, debug ? EGL_TRUE : EGL_FALSE,
+        EGL_NONE
+    };
+
+#endif
+
+    bindApi();
+
     EGLContext toShared;
 
     if (shared)
@@ -264,6 +410,18 @@ void EglContext::createContext(EglContext* shared)
 
     // Create EGL context
     eglCheck(m_context = eglCreateContext(m_display, m_config, toShared, contextVersion));
+
+#if !defined(SFML_OPENGL_ES)
+
+    // Drivers that don't support the requested attributes can still create a default context
+    if (m_context == EGL_NO_CONTEXT)
+    {
+        err() << "Failed to create an EGL context with the requested attributes, falling back to a default context" << std::endl;
+
+        eglCheck(m_context = eglCreateContext(m_display, m_config, toShared, NULL));
+    }
+
+#endif
 }
 
 
@@ -274,6 +432,21 @@ void EglContext::createSurface(EGLNativeWindowType window)
 }
 
 
+////////////////////////////////////////////////////////////
+void EglContext::createPbufferSurface(unsigned int width, unsigned int height)
+{
+    // Note: The EGL specs say that attrib_list can be NULL when passed to eglCreatePbufferSurface,
+    // but this is resulting in a segfault. Bug in Android?
+    EGLint attrib_list[] = {
+        EGL_WIDTH, static_cast<EGLint>(width),
+        EGL_HEIGHT, static_cast<EGLint>(height),
+        EGL_NONE
+    };
+
+    eglCheck(m_surface = eglCreatePbufferSurface(m_display, m_config, attrib_list));
+}
+
+
 ////////////////////////////////////////////////////////////
 void EglContext::destroySurface()
 {
@@ -297,8 +470,13 @@ EGLConfig EglContext::getBestConfig(EGLDisplay display, unsigned int bitsPerPixe
         EGL_STENCIL_SIZE, static_cast<EGLint>(settings.stencilBits),
         EGL_SAMPLE_BUFFERS, static_cast<EGLint>(settings.antialiasingLevel ? 1 : 0),
         EGL_SAMPLES, static_cast<EGLint>(settings.antialiasingLevel),
+#if defined(SFML_OPENGL_ES)
         EGL_SURFACE_TYPE, EGL_WINDOW_BIT | EGL_PBUFFER_BIT,
         EGL_RENDERABLE_TYPE, EGL_OPENGL_ES_BIT,
+#else
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+#endif
         EGL_NONE
     };
 
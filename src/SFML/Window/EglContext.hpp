@@ -125,12 +125,11 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Create the context
     ///
-    /// \param shared       Context to share the new one with (can be NULL)
-    /// \param bitsPerPixel Pixel depth, in bits per pixel
-    /// \param settings     Creation parameters
+    /// \param shared   Context to share the new one with (can be NULL)
+    /// \param settings Creation parameters
     ///
     ////////////////////////////////////////////////////////////
-    void createContext(EglContext* shared);
+    void createContext(EglContext* shared, const ContextSettings& settings);
 
     ////////////////////////////////////////////////////////////
     /// \brief Create the EGL surface
@@ -143,6 +142,15 @@ public:
     ////////////////////////////////////////////////////////////
     void createSurface(EGLNativeWindowType window);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an offscreen EGL surface
+    ///
+    /// \param width  Width of the surface, in pixels
+    /// \param height Height of the surface, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void createPbufferSurface(unsigned int width, unsigned int height);
+
     ////////////////////////////////////////////////////////////
     /// \brief Destroy the EGL surface
     ///
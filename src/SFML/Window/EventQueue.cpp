@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/EventQueue.hpp>
+#include <algorithm>
+
+
+namespace
+{
+    // Initial number of events the queue can hold, must be a power of two
+    const std::size_t initialCapacity = 256;
+
+    // Tell whether two events come from the same source, so that the
+    // most recent can replace the other one when they are coalesced;
+    // events that don't carry a state (keys, buttons, text...) never do
+    bool isSameSource(const sf::Event& left, const sf::Event& right)
+    {
+        if (left.type != right.type)
+            return false;
+
+        switch (left.type)
+        {
+            case sf::Event::Resized:
+            case sf::Event::MouseMoved:
+            case sf::Event::MouseMovedRaw:
+                return true;
+
+            case sf::Event::JoystickMoved:
+                return (left.joystickMove.joystickId == right.joystickMove.joystickId) &&
+                       (left.joystickMove.axis == right.joystickMove.axis);
+
+            case sf::Event::TouchMoved:
+                return left.touch.finger == right.touch.finger;
+
+            case sf::Event::SensorChanged:
+                return left.sensor.type == right.sensor.type;
+
+            default:
+                return false;
+        }
+    }
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+EventQueue::EventQueue() :
+m_events(initialCapacity),
+m_first (0),
+m_count (0)
+{
+    std::fill(m_coalesce, m_coalesce + Event::Count, false);
+}
+
+
+////////////////////////////////////////////////////////////
+bool EventQueue::isEmpty() const
+{
+    return m_count == 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t EventQueue::getSize() const
+{
+    return m_count;
+}
+
+
+////////////////////////////////////////////////////////////
+void EventQueue::push(const Event& event)
+{
+    std::size_t mask = m_events.size() - 1;
+
+    // Replace the last event if it is an older value of the same source
+    if (m_count > 0 && m_coalesce[event.type])
+    {
+        Event& last = m_events[(m_first + m_count - 1) & mask];
+
+        if (isSameSource(last, event))
+        {
+            // Raw motions are relative, they accumulate instead of replacing each other
+            if (event.type == Event::MouseMovedRaw)
+            {
+                last.mouseMoveRaw.deltaX += event.mouseMoveRaw.deltaX;
+                last.mouseMoveRaw.deltaY += event.mouseMoveRaw.deltaY;
+                last.timestamp = event.timestamp;
+            }
+            else
+            {
+                last = event;
+            }
+
+            return;
+        }
+    }
+
+    if (m_count == m_events.size())
+    {
+        grow();
+        mask = m_events.size() - 1;
+    }
+
+    m_events[(m_first + m_count) & mask] = event;
+    m_count++;
+}
+
+
+////////////////////////////////////////////////////////////
+bool EventQueue::pop(Event& event)
+{
+    return pop(&event, 1) == 1;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t EventQueue::pop(Event* events, std::size_t maxCount)
+{
+    std::size_t count = std::min(maxCount, m_count);
+
+    // Copy the events in at most two contiguous parts
+    std::size_t firstPart = std::min(count, m_events.size() - m_first);
+    std::copy(m_events.begin() + m_first, m_events.begin() + m_first + firstPart, events);
+    std::copy(m_events.begin(), m_events.begin() + (count - firstPart), events + firstPart);
+
+    m_first = (m_first + count) & (m_events.size() - 1);
+    m_count -= count;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+void EventQueue::setCoalescing(Event::EventType type, bool enabled)
+{
+    m_coalesce[type] = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void EventQueue::grow()
+{
+    std::vector<Event> events(m_events.size() * 2);
+
+    // Move the pending events to the beginning of the new buffer, in order
+    std::size_t count = m_count;
+    pop(&events[0], count);
+
+    m_events.swap(events);
+    m_first = 0;
+    m_count = count;
+}
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_EVENTQUEUE_HPP
+#define SFML_EVENTQUEUE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Event.hpp>
+#include <vector>
+#include <cstddef>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief First-in first-out queue of events stored in a
+///        preallocated ring buffer
+///
+////////////////////////////////////////////////////////////
+class EventQueue
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Preallocates enough room for the events that a window
+    /// typically receives in a frame; the buffer only grows
+    /// if more events are pending at once.
+    ///
+    ////////////////////////////////////////////////////////////
+    EventQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the queue is empty
+    ///
+    /// \return True if there's no pending event
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isEmpty() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pending events
+    ///
+    /// \return Number of events in the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an event at the end of the queue
+    ///
+    /// If coalescing is enabled for the type of the event and
+    /// the last event of the queue is an older value of the same
+    /// source (same type, and same joystick axis, finger or
+    /// sensor), it is replaced instead. Raw mouse motions are
+    /// added to the last one.
+    ///
+    /// \param event Event to add
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(const Event& event);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove the first event of the queue
+    ///
+    /// \param event Event to be returned
+    ///
+    /// \return True if an event was returned, false if the queue was empty
+    ///
+    ////////////////////////////////////////////////////////////
+    bool pop(Event& event);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove several events from the beginning of the queue
+    ///
+    /// \param events   Array to copy the events to
+    /// \param maxCount Maximum number of events to copy
+    ///
+    /// \return Number of events copied to \a events
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t pop(Event* events, std::size_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable coalescing for a type of events
+    ///
+    /// \param type    Type of events
+    /// \param enabled True to keep only the latest of consecutive events
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCoalescing(Event::EventType type, bool enabled);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Double the capacity of the ring buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void grow();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Event> m_events;                 //!< Ring buffer, its size is always a power of two
+    std::size_t        m_first;                  //!< Index of the first pending event
+    std::size_t        m_count;                  //!< Number of pending events
+    bool               m_coalesce[Event::Count]; //!< Coalescing state of each type of event
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_EVENTQUEUE_HPP
@@ -28,6 +28,7 @@
 #include <SFML/Window/GlContext.hpp>
 #include <SFML/Window/Context.hpp>
 #include <SFML/Window/EglContext.hpp>
+#include <SFML/Window/WindowImpl.hpp>
 #include <SFML/System/ThreadLocalPtr.hpp>
 #include <SFML/System/Mutex.hpp>
 #include <SFML/System/Lock.hpp>
@@ -68,6 +69,10 @@
         #include <SFML/Window/Unix/GlxContext.hpp>
         typedef sf::priv::GlxContext ContextType;
 
+        // Contexts can also be created through EGL, which doesn't need an X display
+        #define SFML_HEADLESS_CONTEXT
+        typedef sf::priv::EglContext HeadlessContextType;
+
     #endif
 
 #elif defined(SFML_SYSTEM_MACOS)
@@ -155,8 +160,39 @@ namespace
     // This mutex is also used to protect the shared context
     // from being locked on multiple threads and for managing
     // the resource count
+    // Activating and deactivating distinct contexts doesn't
+    // need it, so that threads that only switch their own
+    // contexts never contend with each other
     sf::Mutex mutex;
 
+    // Number of times the mutex was acquired, and number of times
+    // it was already held by another thread; both are only modified
+    // while the mutex is held
+    sf::Uint64 lockAcquisitionCount = 0;
+    sf::Uint64 lockContentionCount = 0;
+
+    // Scoped lock on the global mutex that updates the contention counters
+    class ContextLock : sf::NonCopyable
+    {
+    public:
+
+        ContextLock()
+        {
+            if (!mutex.tryLock())
+            {
+                mutex.lock();
+                lockContentionCount++;
+            }
+
+            lockAcquisitionCount++;
+        }
+
+        ~ContextLock()
+        {
+            mutex.unlock();
+        }
+    };
+
     // OpenGL resources counter
     unsigned int resourceCount = 0;
 
@@ -164,7 +200,65 @@ namespace
     sf::ThreadLocalPtr<sf::priv::GlContext> currentContext(NULL);
 
     // The hidden, inactive context that will be shared with all other contexts
-    ContextType* sharedContext = NULL;
+    sf::priv::GlContext* sharedContext = NULL;
+
+    // Did the user request headless contexts, and are they used by the current shared context?
+    bool headlessRequested = false;
+    bool headless = false;
+
+#if defined(SFML_HEADLESS_CONTEXT)
+
+    // Check if contexts can be created through the X display
+    bool isDisplayAvailable()
+    {
+        ::Display* display = XOpenDisplay(NULL);
+
+        if (!display)
+            return false;
+
+        XCloseDisplay(display);
+        return true;
+    }
+
+#endif
+
+    // Create a context of the type used by the shared context; the shared
+    // context must be the one passed in, or NULL to create it
+    sf::priv::GlContext* createContext(sf::priv::GlContext* shared)
+    {
+#if defined(SFML_HEADLESS_CONTEXT)
+        if (headless)
+            return new HeadlessContextType(static_cast<HeadlessContextType*>(shared));
+#endif
+
+        return new ContextType(static_cast<ContextType*>(shared));
+    }
+
+    sf::priv::GlContext* createContext(sf::priv::GlContext* shared, const sf::ContextSettings& settings, const sf::priv::WindowImpl* owner, unsigned int bitsPerPixel)
+    {
+#if defined(SFML_HEADLESS_CONTEXT)
+        if (headless)
+        {
+            // There's no window system to present to, render offscreen instead
+            sf::err() << "Windows can't be displayed with a headless OpenGL context, rendering offscreen instead" << std::endl;
+
+            sf::Vector2u size = owner->getSize();
+            return new HeadlessContextType(static_cast<HeadlessContextType*>(shared), settings, size.x, size.y);
+        }
+#endif
+
+        return new ContextType(static_cast<ContextType*>(shared), settings, owner, bitsPerPixel);
+    }
+
+    sf::priv::GlContext* createContext(sf::priv::GlContext* shared, const sf::ContextSettings& settings, unsigned int width, unsigned int height)
+    {
+#if defined(SFML_HEADLESS_CONTEXT)
+        if (headless)
+            return new HeadlessContextType(static_cast<HeadlessContextType*>(shared), settings, width, height);
+#endif
+
+        return new ContextType(static_cast<ContextType*>(shared), settings, width, height);
+    }
 
     // Unique identifier, used for identifying contexts when managing unshareable OpenGL resources
     sf::Uint64 id = 1; // start at 1, zero is "no context"
@@ -177,7 +271,9 @@ namespace
     ContextDestroyCallbacks contextDestroyCallbacks;
 
     // This structure contains all the state necessary to
-    // track TransientContext usage
+    // track TransientContext usage on a thread; it is kept
+    // with its hidden context between locks, so that only
+    // the first lock of a thread takes the global mutex
     struct TransientContext : private sf::NonCopyable
     {
         ////////////////////////////////////////////////////////////
@@ -185,52 +281,68 @@ namespace
         ///
         ////////////////////////////////////////////////////////////
         TransientContext() :
-        referenceCount   (0),
-        context          (0),
-        sharedContextLock(0),
-        useSharedContext (false)
+        referenceCount(0),
+        context       (NULL),
+        cachedContext (NULL),
+        activated     (false),
+        stale         (false),
+        temporary     (false)
         {
-            if (resourceCount == 0)
-            {
-                context = new sf::Context;
-            }
-            else if (!currentContext)
-            {
-                sharedContextLock = new sf::Lock(mutex);
-                useSharedContext = true;
-                sharedContext->setActive(true);
-            }
-        }
-
-        ////////////////////////////////////////////////////////////
-        /// \brief Destructor
-        ///
-        ////////////////////////////////////////////////////////////
-        ~TransientContext()
-        {
-            if (useSharedContext)
-                sharedContext->setActive(false);
-
-            delete sharedContextLock;
-            delete context;
         }
 
         ///////////////////////////////////////////////////////////
         // Member data
         ////////////////////////////////////////////////////////////
-        unsigned int referenceCount;
-        sf::Context* context;
-        sf::Lock*    sharedContextLock;
-        bool         useSharedContext;
+        sf::Mutex            mutex;          //!< Protects the members against other threads taking or destroying the cached context
+        unsigned int         referenceCount; //!< Number of nested transient context locks on the thread
+        sf::Context*         context;        //!< Context created when no OpenGL resource exists yet
+        sf::priv::GlContext* cachedContext;  //!< Hidden context kept between locks, shared with all other contexts
+        bool                 activated;      //!< Was the cached context activated by the outermost lock?
+        bool                 stale;          //!< Was the shared context destroyed while the cached context was in use?
+        bool                 temporary;      //!< Must the cached context be destroyed when the lock is released?
     };
 
     // This per-thread variable tracks if and how a transient
     // context is currently being used on the current thread
     sf::ThreadLocalPtr<TransientContext> transientContext(NULL);
 
-    // Supported OpenGL extensions
+    // The states of all the threads that used a transient context lock, and the number
+    // of hidden contexts they keep; the number is bounded so that threads that come and
+    // go don't accumulate contexts: once it is reached, a thread takes the context of an
+    // idle one, or uses a temporary context. Both are only accessed with the global mutex
+    // held, and the members of another thread's state with its mutex held as well
+    const std::size_t maxCachedContexts = 4;
+    std::vector<TransientContext*> transientContexts;
+    std::size_t cachedContextCount = 0;
+
+    // Supported OpenGL extensions, sorted so that they can be searched quickly
     std::vector<std::string> extensions;
 
+    // Compare extension names and function table entries with C strings,
+    // so that searching them doesn't need to build std::string objects
+    struct NameLess
+    {
+        bool operator ()(const std::string& left, const char* right) const
+        {
+            return std::strcmp(left.c_str(), right) < 0;
+        }
+
+        bool operator ()(const char* left, const std::string& right) const
+        {
+            return std::strcmp(left, right.c_str()) < 0;
+        }
+
+        bool operator ()(const std::pair<std::string, sf::GlFunctionPointer>& left, const char* right) const
+        {
+            return std::strcmp(left.first.c_str(), right) < 0;
+        }
+
+        bool operator ()(const char* left, const std::pair<std::string, sf::GlFunctionPointer>& right) const
+        {
+            return std::strcmp(left, right.first.c_str()) < 0;
+        }
+    };
+
     // Load our extensions vector with the supported extensions
     void loadExtensions()
     {
@@ -281,6 +393,8 @@ namespace
                 }
             }
         }
+
+        std::sort(extensions.begin(), extensions.end());
     }
 
     // Helper to parse OpenGL version strings
@@ -313,7 +427,7 @@ namespace priv
 void GlContext::initResource()
 {
     // Protect from concurrent access
-    Lock lock(mutex);
+    ContextLock lock;
 
     // If this is the very first resource, trigger the global context initialization
     if (resourceCount == 0)
@@ -326,8 +440,13 @@ void GlContext::initResource()
             return;
         }
 
+        // Choose the type of contexts for the lifetime of the shared context
+#if defined(SFML_HEADLESS_CONTEXT)
+        headless = headlessRequested || !isDisplayAvailable();
+#endif
+
         // Create the shared context
-        sharedContext = new ContextType(NULL);
+        sharedContext = createContext(NULL);
         sharedContext->initialize(ContextSettings());
 
         // Load our extensions vector
@@ -346,7 +465,7 @@ void GlContext::initResource()
 void GlContext::cleanupResource()
 {
     // Protect from concurrent access
-    Lock lock(mutex);
+    ContextLock lock;
 
     // Decrement the resources counter
     resourceCount--;
@@ -357,6 +476,30 @@ void GlContext::cleanupResource()
         if (!sharedContext)
             return;
 
+        // Destroy the hidden contexts kept for transient use, they share the shared
+        // context; the ones currently in use are destroyed when their lock is released
+        for (std::vector<TransientContext*>::iterator it = transientContexts.begin(); it != transientContexts.end(); ++it)
+        {
+            TransientContext& state = **it;
+            sf::Lock stateLock(state.mutex);
+
+            if (!state.cachedContext || state.stale)
+                continue;
+
+            if (state.referenceCount > 0)
+            {
+                state.stale = true;
+            }
+            else
+            {
+                delete state.cachedContext;
+                state.cachedContext = NULL;
+            }
+
+            if (!state.temporary)
+                cachedContextCount--;
+        }
+
         // Destroy the shared context
         delete sharedContext;
         sharedContext = NULL;
@@ -374,38 +517,144 @@ void GlContext::registerContextDestroyCallback(ContextDestroyCallback callback,
 ////////////////////////////////////////////////////////////
 void GlContext::acquireTransientContext()
 {
-    // Protect from concurrent access
-    Lock lock(mutex);
-
     // If this is the first TransientContextLock on this thread
     // construct the state object
-    if (!transientContext)
-        transientContext = new TransientContext;
+    TransientContext* state = transientContext;
+
+    if (!state)
+    {
+        state = new TransientContext;
+        transientContext = state;
+
+        ContextLock lock;
+        transientContexts.push_back(state);
+    }
+
+    {
+        sf::Lock stateLock(state->mutex);
+
+        // Nested locks and threads that already have an active context
+        // don't need anything else
+        if (state->referenceCount++ > 0)
+            return;
+
+        if (currentContext)
+            return;
+
+        // The thread activates the hidden context it kept from its previous lock,
+        // without touching the global mutex
+        if (state->cachedContext && !state->stale)
+        {
+            state->activated = state->cachedContext->setActive(true);
+            return;
+        }
+    }
+
+    ContextLock lock;
+    sf::Lock stateLock(state->mutex);
+
+    // The hidden context shares with a shared context that was destroyed
+    if (state->cachedContext)
+    {
+        delete state->cachedContext;
+        state->cachedContext = NULL;
+        state->stale = false;
+    }
+
+    // Without any OpenGL resource there is no shared context yet, a temporary
+    // context makes sure that one exists for the duration of the lock
+    if (resourceCount == 0)
+    {
+        state->context = new sf::Context;
+        return;
+    }
+
+    state->temporary = false;
+
+    if (cachedContextCount < maxCachedContexts)
+    {
+        state->cachedContext = create();
+        cachedContextCount++;
+    }
+    else
+    {
+        // Take the hidden context of a thread that doesn't use it, typically one that
+        // has finished; if all of them are in use, create one just for this lock
+        for (std::vector<TransientContext*>::iterator it = transientContexts.begin(); it != transientContexts.end(); ++it)
+        {
+            TransientContext& other = **it;
+            if (&other == state)
+                continue;
 
-    // Increase the reference count
-    transientContext->referenceCount++;
+            sf::Lock otherLock(other.mutex);
+
+            if (other.cachedContext && !other.stale && !other.temporary && (other.referenceCount == 0))
+            {
+                state->cachedContext = other.cachedContext;
+                other.cachedContext = NULL;
+                break;
+            }
+        }
+
+        if (!state->cachedContext)
+        {
+            state->cachedContext = create();
+            state->temporary = true;
+        }
+    }
+
+    state->activated = state->cachedContext->setActive(true);
 }
 
 
 ////////////////////////////////////////////////////////////
 void GlContext::releaseTransientContext()
 {
-    // Protect from concurrent access
-    Lock lock(mutex);
+    TransientContext* state = transientContext;
 
     // Make sure a matching acquireTransientContext() was called
-    assert(transientContext);
+    assert(state && (state->referenceCount > 0));
 
-    // Decrease the reference count
-    transientContext->referenceCount--;
+    {
+        sf::Lock stateLock(state->mutex);
+
+        // Only the outermost lock releases the context
+        if (state->referenceCount > 1)
+        {
+            state->referenceCount--;
+            return;
+        }
+
+        // The hidden context is kept for the next lock, inactive so that
+        // another thread can take it once the reference count is zero
+        if (state->activated)
+        {
+            state->cachedContext->setActive(false);
+            state->activated = false;
+        }
+
+        state->referenceCount--;
+
+        if (!state->context && !state->stale && !state->temporary)
+            return;
+    }
 
-    // If this is the last TransientContextLock that is released
-    // destroy the state object
-    if (transientContext->referenceCount == 0)
+    ContextLock lock;
+    sf::Lock stateLock(state->mutex);
+
+    delete state->context;
+    state->context = NULL;
+
+    // Contexts created beyond the bound, and the ones whose shared context was
+    // destroyed while they were in use, are not kept
+    if (state->cachedContext && (state->stale || state->temporary))
     {
-        delete transientContext;
-        transientContext = NULL;
+        delete state->cachedContext;
+        state->cachedContext = NULL;
     }
+
+    state->stale = false;
+    state->temporary = false;
 }
 
 
@@ -415,7 +664,7 @@ GlContext* GlContext::create()
     // Make sure that there's an active context (context creation may need extensions, and thus a valid context)
     assert(sharedContext != NULL);
 
-    Lock lock(mutex);
+    ContextLock lock;
 
     GlContext* context = NULL;
 
@@ -426,7 +675,7 @@ GlContext* GlContext::create()
         sharedContext->setActive(true);
 
         // Create the context
-        context = new ContextType(sharedContext);
+        context = createContext(sharedContext);
 
         sharedContext->setActive(false);
     }
@@ -443,7 +692,7 @@ GlContext* GlContext::create(const ContextSettings& settings, const WindowImpl*
     // Make sure that there's an active context (context creation may need extensions, and thus a valid context)
     assert(sharedContext != NULL);
 
-    Lock lock(mutex);
+    ContextLock lock;
 
     // If resourceCount is 1 we know that we are inside sf::Context or sf::Window
     // Only in this situation we allow the user to indirectly re-create the shared context as a core context
@@ -457,7 +706,7 @@ GlContext* GlContext::create(const ContextSettings& settings, const WindowImpl*
         ContextSettings sharedSettings(0, 0, 0, settings.majorVersion, settings.minorVersion, settings.attributeFlags);
 
         delete sharedContext;
-        sharedContext = new ContextType(NULL, sharedSettings, 1, 1);
+        sharedContext = createContext(NULL, sharedSettings, 1, 1);
         sharedContext->initialize(sharedSettings);
 
         // Reload our extensions vector
@@ -473,7 +722,7 @@ GlContext* GlContext::create(const ContextSettings& settings, const WindowImpl*
         sharedContext->setActive(true);
 
         // Create the context
-        context = new ContextType(sharedContext, settings, owner, bitsPerPixel);
+        context = createContext(sharedContext, settings, owner, bitsPerPixel);
 
         sharedContext->setActive(false);
     }
@@ -491,7 +740,7 @@ GlContext* GlContext::create(const ContextSettings& settings, unsigned int width
     // Make sure that there's an active context (context creation may need extensions, and thus a valid context)
     assert(sharedContext != NULL);
 
-    Lock lock(mutex);
+    ContextLock lock;
 
     // If resourceCount is 1 we know that we are inside sf::Context or sf::Window
     // Only in this situation we allow the user to indirectly re-create the shared context as a core context
@@ -505,7 +754,7 @@ GlContext* GlContext::create(const ContextSettings& settings, unsigned int width
         ContextSettings sharedSettings(0, 0, 0, settings.majorVersion, settings.minorVersion, settings.attributeFlags);
 
         delete sharedContext;
-        sharedContext = new ContextType(NULL, sharedSettings, 1, 1);
+        sharedContext = createContext(NULL, sharedSettings, 1, 1);
         sharedContext->initialize(sharedSettings);
 
         // Reload our extensions vector
@@ -521,7 +770,7 @@ GlContext* GlContext::create(const ContextSettings& settings, unsigned int width
         sharedContext->setActive(true);
 
         // Create the context
-        context = new ContextType(sharedContext, settings, width, height);
+        context = createContext(sharedContext, settings, width, height);
 
         sharedContext->setActive(false);
     }
@@ -536,16 +785,81 @@ GlContext* GlContext::create(const ContextSettings& settings, unsigned int width
 ////////////////////////////////////////////////////////////
 bool GlContext::isExtensionAvailable(const char* name)
 {
-    return std::find(extensions.begin(), extensions.end(), name) != extensions.end();
+    std::vector<std::string>::const_iterator it = std::lower_bound(extensions.begin(), extensions.end(), name, NameLess());
+
+    return (it != extensions.end()) && (*it == name);
 }
 
 
 ////////////////////////////////////////////////////////////
 GlFunctionPointer GlContext::getFunction(const char* name)
+{
+    // Functions may differ between contexts on some platforms, so they
+    // are cached in the table of the context that is active on this thread
+    GlContext* context = currentContext;
+    FunctionTable::iterator it;
+
+    if (context)
+    {
+        it = std::lower_bound(context->m_functions.begin(), context->m_functions.end(), name, NameLess());
+
+        if ((it != context->m_functions.end()) && (it->first == name))
+            return it->second;
+    }
+
+    GlFunctionPointer function = NULL;
+
+    {
+        ContextLock lock;
+
+#if defined(SFML_HEADLESS_CONTEXT)
+        function = headless ? HeadlessContextType::getFunction(name) : ContextType::getFunction(name);
+#else
+        function = ContextType::getFunction(name);
+#endif
+    }
+
+    // Unavailable functions are cached too, so that they are not looked up again
+    if (context)
+        context->m_functions.insert(it, std::make_pair(std::string(name), function));
+
+    return function;
+}
+
+
+////////////////////////////////////////////////////////////
+void GlContext::setHeadlessEnabled(bool enabled)
+{
+    ContextLock lock;
+
+    headlessRequested = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool GlContext::isHeadless()
+{
+    ContextLock lock;
+
+    return headless;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 GlContext::getLockAcquisitionCount()
 {
     Lock lock(mutex);
 
-    return ContextType::getFunction(name);
+    return lockAcquisitionCount;
+}
+
+
+////////////////////////////////////////////////////////////
+Uint64 GlContext::getLockContentionCount()
+{
+    Lock lock(mutex);
+
+    return lockContentionCount;
 }
 
 
@@ -582,8 +896,6 @@ bool GlContext::setActive(bool active)
     {
         if (this != currentContext)
         {
-            Lock lock(mutex);
-
             // Activate the context
             if (makeCurrent(true))
             {
@@ -606,8 +918,6 @@ bool GlContext::setActive(bool active)
     {
         if (this == currentContext)
         {
-            Lock lock(mutex);
-
             // Deactivate the context
             if (makeCurrent(false))
             {
@@ -630,7 +940,8 @@ bool GlContext::setActive(bool active)
 
 ////////////////////////////////////////////////////////////
 GlContext::GlContext() :
-m_id(id++)
+m_id       (id++),
+m_functions()
 {
     // Nothing to do
 }
@@ -33,6 +33,9 @@
 #include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/GlResource.hpp>
 #include <SFML/System/NonCopyable.hpp>
+#include <string>
+#include <utility>
+#include <vector>
 
 
 namespace sf
@@ -150,6 +153,10 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Get the address of an OpenGL function
     ///
+    /// If a context is active on the calling thread, the function
+    /// is resolved once and then taken from the function table
+    /// of that context.
+    ///
     /// \param name Name of the function to get the address of
     ///
     /// \return Address of the OpenGL function, 0 on failure
@@ -157,6 +164,38 @@ public:
     ////////////////////////////////////////////////////////////
     static GlFunctionPointer getFunction(const char* name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Request contexts that don't need a window system
+    ///
+    /// \param enabled True to request headless contexts
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setHeadlessEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the shared context is a headless context
+    ///
+    /// \return True if contexts are created without a window system
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isHeadless();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times the global context mutex was acquired
+    ///
+    /// \return Number of acquisitions since the program started
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getLockAcquisitionCount();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times a thread had to wait for the global context mutex
+    ///
+    /// \return Number of contended acquisitions since the program started
+    ///
+    ////////////////////////////////////////////////////////////
+    static Uint64 getLockContentionCount();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the currently active context's ID
     ///
@@ -291,10 +330,16 @@ private:
     ////////////////////////////////////////////////////////////
     void checkSettings(const ContextSettings& requestedSettings);
 
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    typedef std::vector<std::pair<std::string, GlFunctionPointer> > FunctionTable;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const Uint64 m_id; //!< Unique number that identifies the context
+    const Uint64  m_id;        //!< Unique number that identifies the context
+    FunctionTable m_functions; //!< Functions resolved for this context, sorted by name
 };
 
 } // namespace priv
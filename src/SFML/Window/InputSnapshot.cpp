@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2020 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/InputSnapshot.hpp>
+#include <SFML/Window/Event.hpp>
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+InputSnapshot::InputSnapshot() :
+m_mousePosition(0, 0),
+m_mouseInside  (false),
+m_focus        (false)
+{
+    releaseKeyboardAndMouse();
+
+    std::fill(m_joystickConnected, m_joystickConnected + Joystick::Count, false);
+    std::fill(&m_joystickButtons[0][0], &m_joystickButtons[0][0] + Joystick::Count * Joystick::ButtonCount, false);
+    std::fill(&m_joystickAxes[0][0], &m_joystickAxes[0][0] + Joystick::Count * Joystick::AxisCount, 0.f);
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::update(const Event& event)
+{
+    switch (event.type)
+    {
+        case Event::KeyPressed:
+        case Event::KeyReleased:
+            if ((event.key.code >= 0) && (event.key.code < Keyboard::KeyCount))
+                m_keys[event.key.code] = (event.type == Event::KeyPressed);
+            break;
+
+        case Event::MouseButtonPressed:
+        case Event::MouseButtonReleased:
+            if ((event.mouseButton.button >= 0) && (event.mouseButton.button < Mouse::ButtonCount))
+                m_buttons[event.mouseButton.button] = (event.type == Event::MouseButtonPressed);
+            m_mousePosition = Vector2i(event.mouseButton.x, event.mouseButton.y);
+            break;
+
+        case Event::MouseMoved:
+            m_mousePosition = Vector2i(event.mouseMove.x, event.mouseMove.y);
+            break;
+
+        case Event::MouseEntered:
+            m_mouseInside = true;
+            break;
+
+        case Event::MouseLeft:
+            m_mouseInside = false;
+            break;
+
+        case Event::GainedFocus:
+            m_focus = true;
+            break;
+
+        case Event::LostFocus:
+            // The window won't receive the key and mouse button releases that happen while
+            // it doesn't have the focus; joystick events are not tied to the focus
+            m_focus = false;
+            releaseKeyboardAndMouse();
+            break;
+
+        case Event::JoystickConnected:
+            if (event.joystickConnect.joystickId < Joystick::Count)
+                m_joystickConnected[event.joystickConnect.joystickId] = true;
+            break;
+
+        case Event::JoystickDisconnected:
+        {
+            unsigned int joystick = event.joystickConnect.joystickId;
+            if (joystick < Joystick::Count)
+            {
+                m_joystickConnected[joystick] = false;
+                std::fill(m_joystickButtons[joystick], m_joystickButtons[joystick] + Joystick::ButtonCount, false);
+                std::fill(m_joystickAxes[joystick], m_joystickAxes[joystick] + Joystick::AxisCount, 0.f);
+            }
+            break;
+        }
+
+        case Event::JoystickButtonPressed:
+        case Event::JoystickButtonReleased:
+            if ((event.joystickButton.joystickId < Joystick::Count) && (event.joystickButton.button < Joystick::ButtonCount))
+                m_joystickButtons[event.joystickButton.joystickId][event.joystickButton.button] = (event.type == Event::JoystickButtonPressed);
+            break;
+
+        case Event::JoystickMoved:
+            if (event.joystickMove.joystickId < Joystick::Count)
+                m_joystickAxes[event.joystickMove.joystickId][event.joystickMove.axis] = event.joystickMove.position;
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isKeyPressed(Keyboard::Key key) const
+{
+    return (key >= 0) && (key < Keyboard::KeyCount) && m_keys[key];
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isButtonPressed(Mouse::Button button) const
+{
+    return (button >= 0) && (button < Mouse::ButtonCount) && m_buttons[button];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i InputSnapshot::getMousePosition() const
+{
+    return m_mousePosition;
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isMouseInside() const
+{
+    return m_mouseInside;
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::hasFocus() const
+{
+    return m_focus;
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isJoystickConnected(unsigned int joystick) const
+{
+    return (joystick < Joystick::Count) && m_joystickConnected[joystick];
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isJoystickButtonPressed(unsigned int joystick, unsigned int button) const
+{
+    return (joystick < Joystick::Count) && (button < Joystick::ButtonCount) && m_joystickButtons[joystick][button];
+}
+
+
+////////////////////////////////////////////////////////////
+float InputSnapshot::getJoystickAxisPosition(unsigned int joystick, Joystick::Axis axis) const
+{
+    return (joystick < Joystick::Count) ? m_joystickAxes[joystick][axis] : 0.f;
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::releaseKeyboardAndMouse()
+{
+    std::fill(m_keys, m_keys + Keyboard::KeyCount, false);
+    std::fill(m_buttons, m_buttons + Mouse::ButtonCount, false);
+}
+
+} // namespace sf
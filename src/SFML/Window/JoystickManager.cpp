@@ -64,6 +64,14 @@ const Joystick::Identification& JoystickManager::getIdentification(unsigned int
 ////////////////////////////////////////////////////////////
 void JoystickManager::update()
 {
+#if defined(SFML_SYSTEM_LINUX)
+
+    // Drain the connection notifications even if all the slots are connected,
+    // otherwise the monitor stays readable and waiting for events never blocks
+    JoystickImpl::updateConnections();
+
+#endif
+
     for (int i = 0; i < Joystick::Count; ++i)
     {
         Item& item = m_joysticks[i];
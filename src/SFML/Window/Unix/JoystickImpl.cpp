@@ -29,9 +29,11 @@
 #include <SFML/System/Err.hpp>
 #include <linux/joystick.h>
 #include <libudev.h>
+#include <sys/inotify.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <cstring>
@@ -41,6 +43,9 @@ namespace
     udev* udevContext = 0;
     udev_monitor* udevMonitor = 0;
 
+    // Watches /dev/input for connections and disconnections when the udev monitor is not available
+    int inotifyFile = -1;
+
     struct JoystickRecord
     {
         std::string deviceNode;
@@ -51,6 +56,9 @@ namespace
     typedef std::vector<JoystickRecord> JoystickList;
     JoystickList joystickList;
 
+    // File descriptors of the opened joysticks
+    std::vector<int> joystickFiles;
+
     bool isJoystick(udev_device* udevDevice)
     {
         // If anything goes wrong, we go safe and return true
@@ -262,6 +270,43 @@ namespace
                FD_ISSET(monitorFd, &descriptorSet);
     }
 
+    // Apply the pending connection and disconnection notifications, if any
+    void processHotplugEvents()
+    {
+        if (udevMonitor)
+        {
+            // Check if new joysticks were added/removed since last update
+            while (hasMonitorEvent())
+            {
+                udev_device* udevDevice = udev_monitor_receive_device(udevMonitor);
+
+                // If we can get the specific device, we check that,
+                // otherwise just do a full scan if udevDevice == NULL
+                updatePluggedList(udevDevice);
+
+                if (udevDevice)
+                    udev_device_unref(udevDevice);
+            }
+        }
+        else if (inotifyFile >= 0)
+        {
+            // The content of the notifications doesn't matter, any change in /dev/input triggers a scan
+            char buffer[4096];
+            bool changed = false;
+
+            while (read(inotifyFile, buffer, sizeof(buffer)) > 0)
+                changed = true;
+
+            if (changed)
+                updatePluggedList();
+        }
+        else
+        {
+            // Connections can't be notified, perform a scan every time
+            updatePluggedList();
+        }
+    }
+
     // Get a property value from a udev device
     const char* getUdevAttribute(udev_device* udevDevice, const std::string& attributeName)
     {
@@ -462,7 +507,7 @@ void JoystickImpl::initialize()
 
     if (!udevMonitor)
     {
-        err() << "Failed to create udev monitor, joystick connections and disconnections won't be notified" << std::endl;
+        err() << "Failed to create udev monitor, falling back to watching /dev/input for joystick connections and disconnections" << std::endl;
     }
     else
     {
@@ -489,6 +534,21 @@ void JoystickImpl::initialize()
         }
     }
 
+    // Without udev monitor, watch the device nodes so that we only scan when they change
+    if (!udevMonitor)
+    {
+        inotifyFile = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+        if ((inotifyFile >= 0) && (inotify_add_watch(inotifyFile, "/dev/input", IN_CREATE | IN_DELETE | IN_ATTRIB | IN_MOVED_TO | IN_MOVED_FROM) < 0))
+        {
+            ::close(inotifyFile);
+            inotifyFile = -1;
+        }
+
+        if (inotifyFile < 0)
+            err() << "Failed to watch /dev/input, joystick connections and disconnections will be checked by scanning devices" << std::endl;
+    }
+
     // Do an initial scan
     updatePluggedList();
 }
@@ -497,6 +557,13 @@ void JoystickImpl::initialize()
 ////////////////////////////////////////////////////////////
 void JoystickImpl::cleanup()
 {
+    // Stop watching the device nodes
+    if (inotifyFile >= 0)
+    {
+        ::close(inotifyFile);
+        inotifyFile = -1;
+    }
+
     // Unreference the udev monitor to destroy it
     if (udevMonitor)
     {
@@ -516,32 +583,43 @@ void JoystickImpl::cleanup()
 ////////////////////////////////////////////////////////////
 bool JoystickImpl::isConnected(unsigned int index)
 {
-    // See if we can skip scanning if udev monitor is available
-    if (!udevMonitor)
-    {
-        // udev monitor is not available, perform a scan every query
-        updatePluggedList();
-    }
-    else if (hasMonitorEvent())
-    {
-        // Check if new joysticks were added/removed since last update
-        udev_device* udevDevice = udev_monitor_receive_device(udevMonitor);
+    if (index >= joystickList.size())
+        return false;
 
-        // If we can get the specific device, we check that,
-        // otherwise just do a full scan if udevDevice == NULL
-        updatePluggedList(udevDevice);
+    // Check if the joystick is connected
+    return joystickList[index].plugged;
+}
 
-        if (udevDevice)
-            udev_device_unref(udevDevice);
+
+////////////////////////////////////////////////////////////
+void JoystickImpl::updateConnections()
+{
+    processHotplugEvents();
+}
+
+
+////////////////////////////////////////////////////////////
+bool JoystickImpl::getWaitDescriptors(std::vector<int>& descriptors)
+{
+    descriptors.insert(descriptors.end(), joystickFiles.begin(), joystickFiles.end());
+
+    if (udevMonitor)
+    {
+        descriptors.push_back(udev_monitor_get_fd(udevMonitor));
+        return true;
     }
 
-    if (index >= joystickList.size())
-        return false;
+    if (inotifyFile >= 0)
+    {
+        descriptors.push_back(inotifyFile);
+        return true;
+    }
 
-    // Then check if the joystick is connected
-    return joystickList[index].plugged;
+    // Without any notification, new joysticks are only found by scanning
+    return false;
 }
 
+
 ////////////////////////////////////////////////////////////
 bool JoystickImpl::open(unsigned int index)
 {
@@ -571,6 +649,8 @@ bool JoystickImpl::open(unsigned int index)
             // Reset the joystick state
             m_state = JoystickState();
 
+            joystickFiles.push_back(m_file);
+
             return true;
         }
         else
@@ -586,6 +666,8 @@ bool JoystickImpl::open(unsigned int index)
 ////////////////////////////////////////////////////////////
 void JoystickImpl::close()
 {
+    joystickFiles.erase(std::remove(joystickFiles.begin(), joystickFiles.end(), m_file), joystickFiles.end());
+
     ::close(m_file);
     m_file = -1;
 }
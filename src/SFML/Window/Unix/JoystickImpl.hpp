@@ -30,6 +30,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/JoystickImpl.hpp>
 #include <linux/input.h>
+#include <vector>
 
 
 namespace sf
@@ -72,6 +73,33 @@ public:
     ////////////////////////////////////////////////////////////
     static bool isConnected(unsigned int index);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the connection status of all joysticks
+    ///
+    /// Applies the pending connection and disconnection
+    /// notifications, so that the hotplug monitor doesn't stay
+    /// readable. It must be called once before the slots are
+    /// queried with isConnected.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void updateConnections();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the file descriptors that become readable when joysticks change
+    ///
+    /// The descriptors of the opened joysticks and of the
+    /// hotplug monitor are appended to \a descriptors, so
+    /// that a caller can block until a joystick event is
+    /// available instead of polling.
+    ///
+    /// \param descriptors Vector to append the descriptors to
+    ///
+    /// \return True if connections and disconnections can be waited on,
+    ///         false if they can only be detected by polling
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool getWaitDescriptors(std::vector<int>& descriptors);
+
     ////////////////////////////////////////////////////////////
     /// \brief Open the joystick
     ///
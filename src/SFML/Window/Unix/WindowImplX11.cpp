@@ -34,15 +34,19 @@
 #include <SFML/System/Mutex.hpp>
 #include <SFML/System/Lock.hpp>
 #include <SFML/System/Sleep.hpp>
+#include <SFML/System/Clock.hpp>
 #include <X11/Xlibint.h>
 #include <X11/Xutil.h>
 #include <X11/Xatom.h>
 #include <X11/keysym.h>
 #include <X11/extensions/Xrandr.h>
+#include <X11/extensions/XI2.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <poll.h>
 #include <libgen.h>
+#include <dlfcn.h>
 #include <fcntl.h>
 #include <algorithm>
 #include <vector>
@@ -93,13 +97,183 @@ namespace
         Time time;
     };
 
+    // XInput 2 is loaded at runtime, so that libXi is neither a build nor a runtime
+    // requirement; these declarations match the ones of <X11/extensions/XInput2.h>
+    struct XIValuatorStateData
+    {
+        int            mask_len;
+        unsigned char* mask;
+        double*        values;
+    };
+
+    struct XIRawEventData
+    {
+        int                 type;
+        unsigned long       serial;
+        Bool                send_event;
+        ::Display*          display;
+        int                 extension;
+        int                 evtype;
+        ::Time              time;
+        int                 deviceid;
+        int                 sourceid;
+        int                 detail;
+        int                 flags;
+        XIValuatorStateData valuators;
+        double*             raw_values;
+    };
+
+    struct XIEventMaskData
+    {
+        int            deviceid;
+        int            mask_len;
+        unsigned char* mask;
+    };
+
+    typedef Status (*XIQueryVersionFunc)(::Display*, int*, int*);
+    typedef int    (*XISelectEventsFunc)(::Display*, ::Window, XIEventMaskData*, int);
+
+    struct XInput2LibraryWrapper
+    {
+        XInput2LibraryWrapper() :
+        library       (NULL),
+        checked       (false),
+        opcode        (0),
+        XIQueryVersion(NULL),
+        XISelectEvents(NULL)
+        {
+        }
+
+        ~XInput2LibraryWrapper()
+        {
+            if (library)
+                dlclose(library);
+        }
+
+        // Try to load the library and check that the server supports XInput 2.0,
+        // returns false if raw input is not available
+        bool load(::Display* display)
+        {
+            sf::Lock lock(mutex);
+
+            if (checked)
+                return opcode != 0;
+
+            checked = true;
+
+            int extensionOpcode, firstEvent, firstError;
+            if (!XQueryExtension(display, "XInputExtension", &extensionOpcode, &firstEvent, &firstError))
+                return false;
+
+            library = dlopen("libXi.so.6", RTLD_LAZY);
+
+            if (!library)
+                return false;
+
+            if (!loadEntryPoint(XIQueryVersion, "XIQueryVersion") || !loadEntryPoint(XISelectEvents, "XISelectEvents"))
+            {
+                dlclose(library);
+                library = NULL;
+                return false;
+            }
+
+            int major = 2;
+            int minor = 0;
+            if (XIQueryVersion(display, &major, &minor) != Success)
+                return false;
+
+            opcode = extensionOpcode;
+            return true;
+        }
+
+        template<typename T>
+        bool loadEntryPoint(T& entryPoint, const char* name)
+        {
+            entryPoint = reinterpret_cast<T>(dlsym(library, name));
+
+            return (entryPoint != NULL);
+        }
+
+        sf::Mutex mutex;
+        void*     library;
+        bool      checked;
+        int       opcode;
+
+        XIQueryVersionFunc XIQueryVersion;
+        XISelectEventsFunc XISelectEvents;
+    };
+
+    XInput2LibraryWrapper xinput2;
+
+    // Raw events are selected on the root window, which all the windows share: the selection
+    // is kept while at least one window receives them, and the events are dispatched to the
+    // window that gained the focus last; the predicate below reads the focused window with
+    // Xlib's display lock held, so the selection mutex must not be locked inside it
+    sf::Mutex    rawMotionSelectionMutex;
+    sf::Mutex    rawMotionWindowMutex;
+    unsigned int rawMotionCount  = 0;
+    ::Window     rawMotionWindow = None;
+
     // Filter the events received by windows (only allow those matching a specific window)
     Bool checkEvent(::Display*, XEvent* event, XPointer userData)
     {
+        // Raw input events are not sent to a particular window, they are dispatched to the focused
+        // one; when no window has the focus, any window drains the ones left in the queue
+        if (event->type == GenericEvent)
+        {
+            if ((xinput2.opcode == 0) || (event->xcookie.extension != xinput2.opcode))
+                return False;
+
+            sf::Lock lock(rawMotionWindowMutex);
+            return (rawMotionWindow == None) || (rawMotionWindow == reinterpret_cast< ::Window >(userData));
+        }
+
         // Just check if the event matches the window
         return event->xany.window == reinterpret_cast< ::Window >(userData);
     }
 
+    // Convert a time of the X server, in milliseconds, to the time base of sf::Clock;
+    // the server time is only 32 bits wide and wraps around every 49.7 days
+    sf::Time convertServerTime(::Time time)
+    {
+        static sf::Mutex  mutex;
+        static bool       initialized = false;
+        static bool       monotonic   = false;
+        static sf::Int64  offset      = 0;
+        static sf::Uint64 wraps       = 0;
+        static sf::Uint32 previous    = 0;
+
+        sf::Lock lock(mutex);
+
+        sf::Int64  now     = sf::Clock::getCurrentTime().asMicroseconds() / 1000;
+        sf::Uint32 current = static_cast<sf::Uint32>(time);
+
+        // A local server usually counts the milliseconds of the same monotonic clock, truncated
+        // to 32 bits; it is detected once, from how long ago the first event seems to be generated
+        sf::Int32 age = static_cast<sf::Int32>(static_cast<sf::Uint32>(now) - current);
+
+        if (!initialized)
+        {
+            monotonic = (age > -1000) && (age < 60000);
+            offset = now - current;
+            previous = current;
+            initialized = true;
+        }
+
+        // The server can't be ahead of the client, rounding may make it look so
+        if (monotonic)
+            return sf::microseconds((now - (age > 0 ? age : 0)) * 1000);
+
+        // Otherwise, the server time is extended to 64 bits and shifted by the offset measured
+        // with the first event: a large jump backwards means that the counter wrapped around
+        if ((current < previous) && (previous - current > 0x80000000))
+            wraps++;
+
+        previous = current;
+
+        return sf::microseconds((static_cast<sf::Int64>((wraps << 32) | current) + offset) * 1000);
+    }
+
     // Find the name of the current executable
     std::string findExecutableName()
     {
@@ -498,7 +672,8 @@ m_cursorGrabbed  (false),
 m_windowMapped   (false),
 m_iconPixmap     (0),
 m_iconMaskPixmap (0),
-m_lastInputTime  (0)
+m_lastInputTime  (0),
+m_rawMouseMotion (false)
 {
     // Open a connection with the X server
     m_display = OpenDisplay();
@@ -547,7 +722,8 @@ m_cursorGrabbed  (m_fullscreen),
 m_windowMapped   (false),
 m_iconPixmap     (0),
 m_iconMaskPixmap (0),
-m_lastInputTime  (0)
+m_lastInputTime  (0),
+m_rawMouseMotion (false)
 {
     // Open a connection with the X server
     m_display = OpenDisplay();
@@ -808,7 +984,14 @@ void WindowImplX11::processEvents()
 
     // Pick out the events that are interesting for this window
     while (XCheckIfEvent(m_display, &event, &checkEvent, reinterpret_cast<XPointer>(m_window)))
+    {
+        // The data of generic events must be retrieved before reading the next event,
+        // otherwise Xlib discards it
+        if ((event.type == GenericEvent) && !XGetEventData(m_display, &event.xcookie))
+            event.xcookie.data = NULL;
+
         m_events.push_back(event);
+    }
 
     // Handle the events for this window that we just picked out
     while (!m_events.empty())
@@ -823,6 +1006,57 @@ void WindowImplX11::processEvents()
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowImplX11::waitEvents(Time timeout)
+{
+    // Events for this window may already have been read from the connection,
+    // in which case the connection won't become readable for them
+    XEvent event;
+    if (XCheckIfEvent(m_display, &event, &checkEvent, reinterpret_cast<XPointer>(m_window)))
+    {
+        if ((event.type == GenericEvent) && !XGetEventData(m_display, &event.xcookie))
+            event.xcookie.data = NULL;
+
+        // Keep it for the next call to processEvents, which handles pending events first
+        m_events.push_back(event);
+        return;
+    }
+
+    std::vector<int> descriptors(1, ConnectionNumber(m_display));
+
+#if defined(SFML_SYSTEM_LINUX)
+
+    // Joysticks and their hotplug monitor are file descriptors too
+    bool hotplugDescriptor = JoystickImpl::getWaitDescriptors(descriptors);
+
+#else
+
+    bool hotplugDescriptor = false;
+
+#endif
+
+    // Without a way to be notified of new joysticks, keep polling them regularly
+    if (!hotplugDescriptor && ((timeout < Time::Zero) || (timeout > milliseconds(10))))
+        timeout = milliseconds(10);
+
+    std::vector<pollfd> pollDescriptors(descriptors.size());
+    for (std::size_t i = 0; i < descriptors.size(); ++i)
+    {
+        pollDescriptors[i].fd      = descriptors[i];
+        pollDescriptors[i].events  = POLLIN;
+        pollDescriptors[i].revents = 0;
+    }
+
+    // Round the timeout up, so that we don't wake up just before it expires
+    int pollTimeout = -1;
+    if (timeout >= Time::Zero)
+        pollTimeout = static_cast<int>(std::min<Int64>((timeout.asMicroseconds() + 999) / 1000, 0x7FFFFFFF));
+
+    // Interruptions by signals just make the caller process events and wait again
+    poll(&pollDescriptors[0], pollDescriptors.size(), pollTimeout);
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i WindowImplX11::getPosition() const
 {
@@ -1640,6 +1874,44 @@ void WindowImplX11::updateLastInputTime(::Time time)
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowImplX11::setRawMouseMotionEnabled(bool enabled)
+{
+    if ((enabled == m_rawMouseMotion) || !xinput2.load(m_display))
+        return;
+
+    Lock lock(rawMotionSelectionMutex);
+
+    {
+        Lock windowLock(rawMotionWindowMutex);
+
+        // The focus may move to another window before this one is notified that it lost it
+        if (enabled)
+            rawMotionWindow = m_window;
+        else if (rawMotionWindow == m_window)
+            rawMotionWindow = None;
+    }
+
+    m_rawMouseMotion = enabled;
+
+    // The selection on the root window only changes with the first and the last window receiving raw events
+    if (enabled ? (rawMotionCount++ > 0) : (--rawMotionCount > 0))
+        return;
+
+    unsigned char mask[XIMaskLen(XI_RawMotion)] = {0};
+    if (enabled)
+        XISetMask(mask, XI_RawMotion);
+
+    XIEventMaskData eventMask;
+    eventMask.deviceid = XIAllMasterDevices;
+    eventMask.mask_len = sizeof(mask);
+    eventMask.mask     = mask;
+
+    xinput2.XISelectEvents(m_display, DefaultRootWindow(m_display), &eventMask, 1);
+    XFlush(m_display);
+}
+
+
 ////////////////////////////////////////////////////////////
 void WindowImplX11::createHiddenCursor()
 {
@@ -1668,6 +1940,9 @@ void WindowImplX11::cleanup()
 
     // Unhide the mouse cursor (in case it was hidden)
     setMouseCursorVisible(true);
+
+    // Stop receiving raw mouse motion
+    setRawMouseMotionEnabled(false);
 }
 
 
@@ -1743,6 +2018,9 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
                     err() << "Failed to grab mouse cursor" << std::endl;
             }
 
+            // Raw mouse motion is only reported to the focused window
+            setRawMouseMotionEnabled(true);
+
             Event event;
             event.type = Event::GainedFocus;
             pushEvent(event);
@@ -1771,6 +2049,8 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
             if (m_cursorGrabbed)
                 XUngrabPointer(m_display, CurrentTime);
 
+            setRawMouseMotionEnabled(false);
+
             Event event;
             event.type = Event::LostFocus;
             pushEvent(event);
@@ -1848,6 +2128,7 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
             event.key.control = windowEvent.xkey.state & ControlMask;
             event.key.shift   = windowEvent.xkey.state & ShiftMask;
             event.key.system  = windowEvent.xkey.state & Mod4Mask;
+            event.timestamp   = convertServerTime(windowEvent.xkey.time);
             pushEvent(event);
 
             // Generate a TextEntered event
@@ -1877,6 +2158,7 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
                             Event textEvent;
                             textEvent.type         = Event::TextEntered;
                             textEvent.text.unicode = unicode;
+                            textEvent.timestamp    = event.timestamp;
                             pushEvent(textEvent);
                         }
                     }
@@ -1891,6 +2173,7 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
                         Event textEvent;
                         textEvent.type         = Event::TextEntered;
                         textEvent.text.unicode = static_cast<Uint32>(keyBuffer[0]);
+                        textEvent.timestamp    = event.timestamp;
                         pushEvent(textEvent);
                     }
                 }
@@ -1924,6 +2207,7 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
             event.key.control = windowEvent.xkey.state & ControlMask;
             event.key.shift   = windowEvent.xkey.state & ShiftMask;
             event.key.system  = windowEvent.xkey.state & Mod4Mask;
+            event.timestamp   = convertServerTime(windowEvent.xkey.time);
             pushEvent(event);
 
             break;
@@ -1953,6 +2237,7 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
                     case 8:       event.mouseButton.button = Mouse::XButton1; break;
                     case 9:       event.mouseButton.button = Mouse::XButton2; break;
                 }
+                event.timestamp = convertServerTime(windowEvent.xbutton.time);
                 pushEvent(event);
             }
 
@@ -1983,11 +2268,13 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
                     case 8:       event.mouseButton.button = Mouse::XButton1; break;
                     case 9:       event.mouseButton.button = Mouse::XButton2; break;
                 }
+                event.timestamp = convertServerTime(windowEvent.xbutton.time);
                 pushEvent(event);
             }
             else if ((button == Button4) || (button == Button5))
             {
                 Event event;
+                event.timestamp = convertServerTime(windowEvent.xbutton.time);
 
                 event.type             = Event::MouseWheelMoved;
                 event.mouseWheel.delta = (button == Button4) ? 1 : -1;
@@ -2010,6 +2297,7 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
                 event.mouseWheelScroll.delta = (button == 6) ? 1 : -1;
                 event.mouseWheelScroll.x     = windowEvent.xbutton.x;
                 event.mouseWheelScroll.y     = windowEvent.xbutton.y;
+                event.timestamp              = convertServerTime(windowEvent.xbutton.time);
                 pushEvent(event);
             }
             break;
@@ -2022,17 +2310,57 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
             event.type        = Event::MouseMoved;
             event.mouseMove.x = windowEvent.xmotion.x;
             event.mouseMove.y = windowEvent.xmotion.y;
+            event.timestamp   = convertServerTime(windowEvent.xmotion.time);
             pushEvent(event);
             break;
         }
 
+        // Raw input
+        case GenericEvent:
+        {
+            // The data was retrieved when the event was read from the queue
+            if ((windowEvent.xcookie.extension == xinput2.opcode) && windowEvent.xcookie.data)
+            {
+                // Events drained by a window that doesn't have the focus are discarded
+                if ((windowEvent.xcookie.evtype == XI_RawMotion) && m_rawMouseMotion)
+                {
+                    const XIRawEventData* rawEvent = static_cast<const XIRawEventData*>(windowEvent.xcookie.data);
+
+                    // Values are only stored for the valuators whose bit is set in the mask;
+                    // the first two valuators of a pointer are its X and Y axes
+                    const double* value = rawEvent->raw_values;
+                    double delta[2] = {0.0, 0.0};
+
+                    for (int i = 0; (i < 2) && (i < rawEvent->valuators.mask_len * 8); ++i)
+                    {
+                        if (XIMaskIsSet(rawEvent->valuators.mask, i))
+                            delta[i] = *value++;
+                    }
+
+                    if ((delta[0] != 0.0) || (delta[1] != 0.0))
+                    {
+                        Event event;
+                        event.type                = Event::MouseMovedRaw;
+                        event.mouseMoveRaw.deltaX = static_cast<float>(delta[0]);
+                        event.mouseMoveRaw.deltaY = static_cast<float>(delta[1]);
+                        event.timestamp           = convertServerTime(rawEvent->time);
+                        pushEvent(event);
+                    }
+                }
+
+                XFreeEventData(m_display, &windowEvent.xcookie);
+            }
+            break;
+        }
+
         // Mouse entered
         case EnterNotify:
         {
             if (windowEvent.xcrossing.mode == NotifyNormal)
             {
                 Event event;
-                event.type = Event::MouseEntered;
+                event.type      = Event::MouseEntered;
+                event.timestamp = convertServerTime(windowEvent.xcrossing.time);
                 pushEvent(event);
             }
             break;
@@ -2044,7 +2372,8 @@ bool WindowImplX11::processEvent(XEvent& windowEvent)
             if (windowEvent.xcrossing.mode == NotifyNormal)
             {
                 Event event;
-                event.type = Event::MouseLeft;
+                event.type      = Event::MouseLeft;
+                event.timestamp = convertServerTime(windowEvent.xcrossing.time);
                 pushEvent(event);
             }
             break;
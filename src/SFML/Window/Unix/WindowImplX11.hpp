@@ -195,6 +195,14 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual void processEvents();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until new events may be available from the operating system
+    ///
+    /// \param timeout Maximum time to wait, a negative value waits forever
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void waitEvents(Time timeout);
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -243,6 +251,19 @@ private:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start or stop receiving raw mouse motion events
+    ///
+    /// Raw events are selected on the root window, so they are
+    /// only enabled while the window has the focus. The selection
+    /// is shared by all the windows, and the events are only
+    /// dispatched to the window that gained the focus last.
+    ///
+    /// \param enabled True to receive the events, false to stop
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRawMouseMotionEnabled(bool enabled);
+
     ////////////////////////////////////////////////////////////
     /// \brief Create a transparent mouse cursor
     ///
@@ -320,6 +341,7 @@ private:
     Pixmap             m_iconPixmap;     ///< The current icon pixmap if in use
     Pixmap             m_iconMaskPixmap; ///< The current icon mask pixmap if in use
     ::Time             m_lastInputTime;  ///< Last time we received user input
+    bool               m_rawMouseMotion; ///< Is the window receiving raw mouse motion events?
 };
 
 } // namespace priv
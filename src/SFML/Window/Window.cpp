@@ -28,7 +28,6 @@
 #include <SFML/Window/Window.hpp>
 #include <SFML/Window/GlContext.hpp>
 #include <SFML/Window/WindowImpl.hpp>
-#include <SFML/System/Sleep.hpp>
 #include <SFML/System/Err.hpp>
 
 
@@ -36,8 +35,8 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 Window::Window() :
-m_context       (NULL),
-m_frameTimeLimit(Time::Zero)
+m_context   (NULL),
+m_framePacer()
 {
 
 }
@@ -45,8 +44,8 @@ m_frameTimeLimit(Time::Zero)
 
 ////////////////////////////////////////////////////////////
 Window::Window(VideoMode mode, const String& title, Uint32 style, const ContextSettings& settings) :
-m_context       (NULL),
-m_frameTimeLimit(Time::Zero)
+m_context   (NULL),
+m_framePacer()
 {
     Window::create(mode, title, style, settings);
 }
@@ -54,8 +53,8 @@ m_frameTimeLimit(Time::Zero)
 
 ////////////////////////////////////////////////////////////
 Window::Window(WindowHandle handle, const ContextSettings& settings) :
-m_context       (NULL),
-m_frameTimeLimit(Time::Zero)
+m_context   (NULL),
+m_framePacer()
 {
     Window::create(handle, settings);
 }
@@ -176,6 +175,9 @@ void Window::setVerticalSyncEnabled(bool enabled)
 {
     if (setActive())
         m_context->setVerticalSyncEnabled(enabled);
+
+    // Swapping the buffers already waits precisely for the display, there's no need to spin
+    m_framePacer.setSpinEnabled(!enabled);
 }
 
 
@@ -183,9 +185,16 @@ void Window::setVerticalSyncEnabled(bool enabled)
 void Window::setFramerateLimit(unsigned int limit)
 {
     if (limit > 0)
-        m_frameTimeLimit = seconds(1.f / limit);
+        m_framePacer.setFrameTime(microseconds(1000000 / limit));
     else
-        m_frameTimeLimit = Time::Zero;
+        m_framePacer.setFrameTime(Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+const FramePacer::Statistics& Window::getFrameStatistics() const
+{
+    return m_framePacer.getStatistics();
 }
 
 
@@ -216,14 +225,31 @@ void Window::display()
 {
     // Display the backbuffer on screen
     if (setActive())
-        m_context->display();
-
-    // Limit the framerate if needed
-    if (m_frameTimeLimit != Time::Zero)
     {
-        sleep(m_frameTimeLimit - m_clock.getElapsedTime());
-        m_clock.restart();
+        if (onPreDisplay())
+        {
+            m_context->display();
+            onPostDisplay();
+        }
     }
+
+    // Limit the framerate if needed
+    m_framePacer.wait();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Window::onPreDisplay()
+{
+    // Always display by default
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Window::onPostDisplay()
+{
+    // Nothing by default
 }
 
 
@@ -235,7 +261,8 @@ void Window::initialize()
     setFramerateLimit(0);
 
     // Reset frame time
-    m_clock.restart();
+    m_framePacer.restart();
+    m_framePacer.resetStatistics();
 
     // Activate the window
     setActive();
@@ -28,7 +28,11 @@
 #include <SFML/Window/WindowBase.hpp>
 #include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/WindowImpl.hpp>
+#include <SFML/Window/Joystick.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <SFML/System/Lock.hpp>
 #include <SFML/System/Err.hpp>
+#include <algorithm>
 
 
 namespace
@@ -41,8 +45,10 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 WindowBase::WindowBase() :
-m_impl          (NULL),
-m_size          (0, 0)
+m_impl              (NULL),
+m_size              (0, 0),
+m_inputSnapshot     (),
+m_inputSnapshotMutex()
 {
 
 }
@@ -50,8 +56,10 @@ m_size          (0, 0)
 
 ////////////////////////////////////////////////////////////
 WindowBase::WindowBase(VideoMode mode, const String& title, Uint32 style) :
-m_impl          (NULL),
-m_size          (0, 0)
+m_impl              (NULL),
+m_size              (0, 0),
+m_inputSnapshot     (),
+m_inputSnapshotMutex()
 {
     WindowBase::create(mode, title, style);
 }
@@ -59,8 +67,10 @@ m_size          (0, 0)
 
 ////////////////////////////////////////////////////////////
 WindowBase::WindowBase(WindowHandle handle) :
-m_impl          (NULL),
-m_size          (0, 0)
+m_impl              (NULL),
+m_size              (0, 0),
+m_inputSnapshot     (),
+m_inputSnapshotMutex()
 {
     WindowBase::create(handle);
 }
@@ -169,6 +179,34 @@ bool WindowBase::pollEvent(Event& event)
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t WindowBase::pollEvents(Event* events, std::size_t maxCount)
+{
+    if (!m_impl)
+        return 0;
+
+    std::size_t count = m_impl->popEvents(events, maxCount);
+
+    // Remove the events that the window filtered out
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (filterEvent(events[i]))
+            events[kept++] = events[i];
+    }
+
+    return kept;
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowBase::setEventCoalescing(Event::EventType type, bool enabled)
+{
+    if (m_impl)
+        m_impl->setEventCoalescing(type, enabled);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool WindowBase::waitEvent(Event& event)
 {
@@ -183,6 +221,29 @@ bool WindowBase::waitEvent(Event& event)
 }
 
 
+////////////////////////////////////////////////////////////
+bool WindowBase::waitEvent(Event& event, Time timeout)
+{
+    if (m_impl && m_impl->popEvent(event, std::max(timeout, Time::Zero)))
+    {
+        return filterEvent(event);
+    }
+    else
+    {
+        return false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+InputSnapshot WindowBase::getInputSnapshot() const
+{
+    Lock lock(m_inputSnapshotMutex);
+
+    return m_inputSnapshot;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i WindowBase::getPosition() const
 {
@@ -332,6 +393,12 @@ void WindowBase::onResize()
 ////////////////////////////////////////////////////////////
 bool WindowBase::filterEvent(const Event& event)
 {
+    // Keep the input snapshot in sync with the events seen by the user
+    {
+        Lock lock(m_inputSnapshotMutex);
+        m_inputSnapshot.update(event);
+    }
+
     // Notify resize events to the derived class
     if (event.type == Event::Resized)
     {
@@ -358,11 +425,78 @@ void WindowBase::initialize()
     // Get and cache the initial size of the window
     m_size = m_impl->getSize();
 
+    // Seed the input snapshot with the state that no event will report
+    initializeInputSnapshot();
+
     // Notify the derived class
     onCreate();
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowBase::initializeInputSnapshot()
+{
+    InputSnapshot snapshot;
+    Event event;
+
+    if (m_impl->hasFocus())
+    {
+        event.type = Event::GainedFocus;
+        snapshot.update(event);
+    }
+
+    Vector2i position = Mouse::getPosition(*this);
+    event.type = Event::MouseMoved;
+    event.mouseMove.x = position.x;
+    event.mouseMove.y = position.y;
+    snapshot.update(event);
+
+    if ((position.x >= 0) && (position.y >= 0) && (position.x < static_cast<int>(m_size.x)) && (position.y < static_cast<int>(m_size.y)))
+    {
+        event.type = Event::MouseEntered;
+        snapshot.update(event);
+    }
+
+    // Joysticks that are already connected won't send a JoystickConnected event
+    for (unsigned int i = 0; i < Joystick::Count; ++i)
+    {
+        if (!Joystick::isConnected(i))
+            continue;
+
+        event.type = Event::JoystickConnected;
+        event.joystickConnect.joystickId = i;
+        snapshot.update(event);
+
+        for (int j = 0; j < Joystick::AxisCount; ++j)
+        {
+            Joystick::Axis axis = static_cast<Joystick::Axis>(j);
+            if (Joystick::hasAxis(i, axis))
+            {
+                event.type = Event::JoystickMoved;
+                event.joystickMove.joystickId = i;
+                event.joystickMove.axis = axis;
+                event.joystickMove.position = Joystick::getAxisPosition(i, axis);
+                snapshot.update(event);
+            }
+        }
+
+        for (unsigned int j = 0; j < Joystick::getButtonCount(i); ++j)
+        {
+            if (Joystick::isButtonPressed(i, j))
+            {
+                event.type = Event::JoystickButtonPressed;
+                event.joystickButton.joystickId = i;
+                event.joystickButton.button = j;
+                snapshot.update(event);
+            }
+        }
+    }
+
+    Lock lock(m_inputSnapshotMutex);
+    m_inputSnapshot = snapshot;
+}
+
+
 ////////////////////////////////////////////////////////////
 const WindowBase* WindowBase::getFullscreenWindow()
 {
@@ -29,6 +29,7 @@
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/JoystickManager.hpp>
 #include <SFML/Window/SensorManager.hpp>
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Sleep.hpp>
 #include <algorithm>
 #include <cmath>
@@ -125,24 +126,39 @@ void WindowImpl::setJoystickThreshold(float threshold)
 
 ////////////////////////////////////////////////////////////
 bool WindowImpl::popEvent(Event& event, bool block)
+{
+    return popEvent(event, block ? microseconds(-1) : Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+bool WindowImpl::popEvent(Event& event, Time timeout)
 {
     // If the event queue is empty, let's first check if new events are available from the OS
-    if (m_events.empty())
+    if (m_events.isEmpty())
     {
         // Get events from the system
         processJoystickEvents();
         processSensorEvents();
         processEvents();
 
-        // In blocking mode, we must process events until one is triggered
-        if (block)
+        // In blocking mode, we must wait and process events until one is triggered
+        if (timeout != Time::Zero)
         {
-            // Here we use a manual wait loop instead of the optimized
-            // wait-event provided by the OS, so that we don't skip joystick
-            // events (which require polling)
-            while (m_events.empty())
+            Clock clock;
+
+            while (m_events.isEmpty())
             {
-                sleep(milliseconds(10));
+                Time remaining = timeout;
+
+                if (timeout > Time::Zero)
+                {
+                    remaining = timeout - clock.getElapsedTime();
+                    if (remaining <= Time::Zero)
+                        break;
+                }
+
+                waitEvents(remaining);
                 processJoystickEvents();
                 processSensorEvents();
                 processEvents();
@@ -151,15 +167,29 @@ bool WindowImpl::popEvent(Event& event, bool block)
     }
 
     // Pop the first event of the queue, if it is not empty
-    if (!m_events.empty())
-    {
-        event = m_events.front();
-        m_events.pop();
+    return m_events.pop(event);
+}
 
-        return true;
+
+////////////////////////////////////////////////////////////
+std::size_t WindowImpl::popEvents(Event* events, std::size_t maxCount)
+{
+    // If the event queue is empty, let's first check if new events are available from the OS
+    if (m_events.isEmpty())
+    {
+        processJoystickEvents();
+        processSensorEvents();
+        processEvents();
     }
 
-    return false;
+    return m_events.pop(events, maxCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowImpl::setEventCoalescing(Event::EventType type, bool enabled)
+{
+    m_events.setCoalescing(type, enabled);
 }
 
 
@@ -170,6 +200,18 @@ void WindowImpl::pushEvent(const Event& event)
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowImpl::waitEvents(Time timeout)
+{
+    // Here we use a manual wait loop instead of the optimized
+    // wait-event provided by the OS, so that we don't skip joystick
+    // events (which require polling)
+    Time interval = milliseconds(10);
+
+    sleep(((timeout >= Time::Zero) && (timeout < interval)) ? timeout : interval);
+}
+
+
 ////////////////////////////////////////////////////////////
 void WindowImpl::processJoystickEvents()
 {
@@ -31,9 +31,11 @@
 #include <SFML/Config.hpp>
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/System/String.hpp>
+#include <SFML/System/Time.hpp>
 #include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/CursorImpl.hpp>
 #include <SFML/Window/Event.hpp>
+#include <SFML/Window/EventQueue.hpp>
 #include <SFML/Window/Joystick.hpp>
 #include <SFML/Window/JoystickImpl.hpp>
 #include <SFML/Window/Sensor.hpp>
@@ -41,7 +43,6 @@
 #include <SFML/Window/VideoMode.hpp>
 #include <SFML/Window/WindowHandle.hpp>
 #include <SFML/Window/Window.hpp>
-#include <queue>
 #include <set>
 
 namespace sf
@@ -114,6 +115,37 @@ public:
     ////////////////////////////////////////////////////////////
     bool popEvent(Event& event, bool block);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the next window event available, waiting at most a given time
+    ///
+    /// \param event   Event to be returned
+    /// \param timeout Maximum time to wait for an event, a negative value waits forever
+    ///
+    /// \return True if an event was returned, false if the timeout expired
+    ///
+    ////////////////////////////////////////////////////////////
+    bool popEvent(Event& event, Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return several window events at once, without blocking
+    ///
+    /// \param events   Array to copy the events to
+    /// \param maxCount Maximum number of events to return
+    ///
+    /// \return Number of events copied to \a events
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t popEvents(Event* events, std::size_t maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable coalescing for a type of events
+    ///
+    /// \param type    Type of events
+    /// \param enabled True to keep only the latest of consecutive events
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEventCoalescing(Event::EventType type, bool enabled);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the OS-specific handle of the window
     ///
@@ -265,6 +297,19 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual void processEvents() = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until new events may be available from the operating system
+    ///
+    /// This function may return early, the caller processes
+    /// the events and waits again if none was generated.
+    /// The default implementation sleeps for a short time,
+    /// so that joysticks and sensors are regularly polled.
+    ///
+    /// \param timeout Maximum time to wait, a negative value waits forever
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void waitEvents(Time timeout);
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -282,7 +327,7 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::queue<Event> m_events;                                              //!< Queue of available events
+    EventQueue        m_events;                                              //!< Queue of available events
     JoystickState     m_joystickStates[Joystick::Count];                     //!< Previous state of the joysticks
     Vector3f          m_sensorValue[Sensor::Count];                          //!< Previous value of the sensors
     float             m_joystickThreshold;                                   //!< Joystick threshold (minimum motion for "move" event to be generated)
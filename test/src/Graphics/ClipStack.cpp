@@ -0,0 +1,75 @@
+#include <SFML/Graphics/ClipStack.hpp>
+#include <SFML/Graphics/CommandList.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include "GraphicsUtil.hpp"
+
+TEST_CASE("sf::ClipStack class", "[graphics]")
+{
+    sf::CommandList list(sf::Vector2u(100, 100));
+    sf::ClipStack clips(list);
+
+    SECTION("Construction")
+    {
+        CHECK(clips.getDepth() == 0);
+        CHECK(clips.getStencilMode() == sf::StencilMode());
+    }
+
+    SECTION("Aligned rectangles use the scissor")
+    {
+        clips.push(sf::FloatRect(10.f, 20.f, 50.f, 40.f));
+        CHECK(clips.getDepth() == 1);
+        CHECK(clips.getStencilMode() == sf::StencilMode());
+        CHECK(list.getScissor(list.getView()) == sf::IntRect(10, 20, 50, 40));
+        CHECK(list.getCommandCount() == 0);
+
+        // Nested rectangles are intersected
+        sf::Transform transform;
+        transform.translate(40.f, 0.f);
+        clips.push(sf::FloatRect(0.f, 0.f, 50.f, 50.f), transform);
+        CHECK(list.getScissor(list.getView()) == sf::IntRect(40, 20, 20, 30));
+
+        clips.pop();
+        CHECK(list.getScissor(list.getView()) == sf::IntRect(10, 20, 50, 40));
+
+        clips.pop();
+        CHECK(clips.getDepth() == 0);
+        CHECK(list.getView().getScissor() == sf::FloatRect(0.f, 0.f, 1.f, 1.f));
+        CHECK(list.getCommandCount() == 0);
+    }
+
+    SECTION("Other regions use the stencil buffer")
+    {
+        sf::Transform rotation;
+        rotation.rotate(45.f, 50.f, 50.f);
+        clips.push(sf::FloatRect(25.f, 25.f, 50.f, 50.f), rotation);
+        CHECK(clips.getDepth() == 1);
+        CHECK(clips.getStencilMode() == sf::StencilMode(sf::StencilMode::Equal, sf::StencilMode::Keep, 1, ~0u, false));
+
+        sf::RectangleShape shape(sf::Vector2f(10.f, 10.f));
+        clips.push(shape);
+        CHECK(clips.getDepth() == 2);
+        CHECK(clips.getStencilMode().stencilReference == 2);
+
+        // Widgets drawn at the same depth share their states and are merged
+        sf::VertexArray triangle(sf::Triangles, 3);
+        triangle[1].position = sf::Vector2f(10.f, 0.f);
+        triangle[2].position = sf::Vector2f(0.f, 10.f);
+
+        std::size_t commandCount = list.getCommandCount();
+        clips.draw(triangle);
+        clips.draw(triangle);
+        CHECK(list.getCommandCount() == commandCount + 1);
+
+        clips.pop();
+        CHECK(clips.getStencilMode().stencilReference == 1);
+
+        clips.pop();
+        CHECK(clips.getDepth() == 0);
+        CHECK(clips.getStencilMode() == sf::StencilMode());
+
+        // Popping an empty stack does nothing
+        clips.pop();
+        CHECK(clips.getDepth() == 0);
+    }
+}
@@ -0,0 +1,98 @@
+#include <SFML/Graphics/CommandList.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include "GraphicsUtil.hpp"
+
+TEST_CASE("sf::CommandList class", "[graphics]")
+{
+    sf::Vertex triangle[3];
+    triangle[1].position = sf::Vector2f(10.f, 0.f);
+    triangle[2].position = sf::Vector2f(0.f, 10.f);
+
+    SECTION("Construction")
+    {
+        sf::CommandList list(sf::Vector2u(640, 480));
+        CHECK(list.getSize() == sf::Vector2u(640, 480));
+        CHECK(list.getCommandCount() == 0);
+        CHECK(list.getVertexCount() == 0);
+        CHECK(list.getDefaultView().getSize() == sf::Vector2f(640.f, 480.f));
+        CHECK(!list.setActive());
+    }
+
+    SECTION("Draws sharing render states are merged")
+    {
+        sf::CommandList list;
+        sf::Transform transform;
+        transform.translate(5.f, 5.f);
+
+        list.draw(triangle, 3, sf::Triangles);
+        list.draw(triangle, 3, sf::Triangles, transform);
+        list.draw(triangle, 3, sf::Triangles, sf::BlendAdd);
+
+        CHECK(list.getCommandCount() == 2);
+        CHECK(list.getVertexCount() == 9);
+    }
+
+    SECTION("Strips and fans are never merged")
+    {
+        sf::CommandList list;
+        list.draw(triangle, 3, sf::TriangleStrip);
+        list.draw(triangle, 3, sf::TriangleStrip);
+        list.draw(triangle, 3, sf::TriangleFan);
+
+        CHECK(list.getCommandCount() == 3);
+        CHECK(list.getVertexCount() == 9);
+    }
+
+    SECTION("Incomplete primitives break merging")
+    {
+        sf::CommandList list;
+        list.draw(triangle, 2, sf::Triangles);
+        list.draw(triangle, 3, sf::Triangles);
+
+        CHECK(list.getCommandCount() == 2);
+    }
+
+    SECTION("Clears and views are recorded in order")
+    {
+        sf::CommandList list(sf::Vector2u(100, 100));
+        list.clear(sf::Color::Red);
+        list.draw(triangle, 3, sf::Triangles);
+        list.setView(sf::View(sf::FloatRect(0.f, 0.f, 50.f, 50.f)));
+        list.draw(triangle, 3, sf::Triangles);
+
+        // Clear, draw, view, draw
+        CHECK(list.getCommandCount() == 4);
+    }
+
+    SECTION("Submitting into another list")
+    {
+        sf::CommandList source;
+        source.draw(triangle, 3, sf::Triangles);
+        source.draw(triangle, 3, sf::Triangles);
+
+        sf::CommandList destination;
+        destination.submit(source);
+        destination.submit(source);
+
+        CHECK(destination.getCommandCount() == 1);
+        CHECK(destination.getVertexCount() == 12);
+    }
+
+    SECTION("Reset")
+    {
+        sf::CommandList list;
+        list.draw(triangle, 3, sf::Triangles);
+        list.reset();
+
+        CHECK(list.getCommandCount() == 0);
+        CHECK(list.getVertexCount() == 0);
+
+        list.setView(sf::View(sf::FloatRect(0.f, 0.f, 50.f, 50.f)));
+        list.draw(triangle, 3, sf::Triangles);
+        list.reset();
+        list.draw(triangle, 3, sf::Triangles);
+
+        // The view set before the reset is recorded again
+        CHECK(list.getCommandCount() == 2);
+    }
+}
@@ -0,0 +1,64 @@
+#include <SFML/Graphics/DrawQueue.hpp>
+#include "GraphicsUtil.hpp"
+
+TEST_CASE("sf::DrawQueue class", "[graphics]")
+{
+    sf::Vertex quad[4];
+    sf::RenderStates first(sf::BlendAlpha);
+    sf::RenderStates second(sf::BlendAdd);
+
+    SECTION("Construction")
+    {
+        sf::DrawQueue queue;
+        CHECK(queue.getDrawCount() == 0);
+        CHECK(queue.getDrawCallCount() == 0);
+    }
+
+    SECTION("Ordered draws keep their submission order")
+    {
+        sf::DrawQueue queue;
+        queue.add(quad, 4, sf::Quads, 0, first);
+        queue.add(quad, 4, sf::Quads, 0, second);
+        queue.add(quad, 4, sf::Quads, 0, first);
+
+        CHECK(queue.getDrawCount() == 3);
+        CHECK(queue.getDrawCallCount() == 3);
+    }
+
+    SECTION("Unordered draws are grouped by render states")
+    {
+        sf::DrawQueue queue;
+        queue.add(quad, 4, sf::Quads, 0, first, sf::DrawQueue::Unordered);
+        queue.add(quad, 4, sf::Quads, 0, second, sf::DrawQueue::Unordered);
+        queue.add(quad, 4, sf::Quads, 0, first, sf::DrawQueue::Unordered);
+        queue.add(quad, 4, sf::Quads, 0, second, sf::DrawQueue::Unordered);
+
+        CHECK(queue.getDrawCount() == 4);
+        CHECK(queue.getDrawCallCount() == 2);
+    }
+
+    SECTION("Layers are never mixed")
+    {
+        sf::DrawQueue queue;
+        queue.add(quad, 4, sf::Quads, 1, first, sf::DrawQueue::Unordered);
+        queue.add(quad, 4, sf::Quads, 0, first, sf::DrawQueue::Unordered);
+        queue.add(quad, 4, sf::Quads, 1, first, sf::DrawQueue::Unordered);
+
+        // Layer 0 then layer 1, all sharing the same states
+        CHECK(queue.getDrawCallCount() == 1);
+
+        // The layers are now separated by a different draw
+        queue.add(quad, 4, sf::Quads, 0, second);
+        CHECK(queue.getDrawCallCount() == 3);
+    }
+
+    SECTION("Clear")
+    {
+        sf::DrawQueue queue;
+        queue.add(quad, 4, sf::Quads, 0);
+        queue.clear();
+
+        CHECK(queue.getDrawCount() == 0);
+        CHECK(queue.getDrawCallCount() == 0);
+    }
+}
@@ -0,0 +1,64 @@
+#include <SFML/Graphics/Image.hpp>
+#include "GraphicsUtil.hpp"
+
+TEST_CASE("sf::Image class", "[graphics]")
+{
+    SECTION("Premultiplied alpha")
+    {
+        // Every combination of color component and alpha
+        sf::Image image;
+        image.create(257, 256);
+
+        for (unsigned int y = 0; y < 256; ++y)
+            for (unsigned int x = 0; x < 257; ++x)
+                image.setPixel(x, y, sf::Color(x % 256, 255 - x % 256, (x * 7) % 256, y));
+
+        image.premultiplyAlpha();
+
+        bool exact = true;
+        for (unsigned int y = 0; y < 256; ++y)
+        {
+            for (unsigned int x = 0; x < 257; ++x)
+            {
+                sf::Color pixel = image.getPixel(x, y);
+                sf::Color expected(static_cast<sf::Uint8>((x % 256 * y + 127) / 255),
+                                   static_cast<sf::Uint8>(((255 - x % 256) * y + 127) / 255),
+                                   static_cast<sf::Uint8>(((x * 7) % 256 * y + 127) / 255),
+                                   static_cast<sf::Uint8>(y));
+
+                if (pixel != expected)
+                    exact = false;
+            }
+        }
+
+        CHECK(exact);
+    }
+
+    SECTION("Premultiplied alpha on a pixel count that is not a multiple of the vector width")
+    {
+        // 8 pixels go through the vectorized path and the last 3 through the scalar one
+        sf::Image image;
+        image.create(11, 1);
+
+        for (unsigned int x = 0; x < 11; ++x)
+            image.setPixel(x, 0, sf::Color(200, 100, 255, static_cast<sf::Uint8>(x * 25)));
+
+        image.premultiplyAlpha();
+
+        for (unsigned int x = 0; x < 11; ++x)
+        {
+            unsigned int alpha = x * 25;
+            CHECK(image.getPixel(x, 0) == sf::Color(static_cast<sf::Uint8>((200 * alpha + 127) / 255),
+                                                    static_cast<sf::Uint8>((100 * alpha + 127) / 255),
+                                                    static_cast<sf::Uint8>((255 * alpha + 127) / 255),
+                                                    static_cast<sf::Uint8>(alpha)));
+        }
+    }
+
+    SECTION("Premultiplied alpha on an empty image")
+    {
+        sf::Image image;
+        image.premultiplyAlpha();
+        CHECK(image.getSize() == sf::Vector2u(0, 0));
+    }
+}
@@ -0,0 +1,75 @@
+#include <SFML/Graphics/ParticleSystem.hpp>
+#include "GraphicsUtil.hpp"
+
+TEST_CASE("sf::ParticleSystem class", "[graphics]")
+{
+    sf::ParticleSystem particles;
+
+    SECTION("Emission")
+    {
+        CHECK(particles.getParticleCount() == 0);
+
+        particles.emit(sf::Vector2f(1.f, 2.f), sf::Vector2f(0.f, 0.f), sf::Color::White, sf::seconds(1.f));
+        particles.emit(sf::Vector2f(3.f, 4.f), sf::Vector2f(0.f, 0.f), sf::Color::White, sf::seconds(2.f));
+
+        // Particles that would already be dead are not emitted
+        particles.emit(sf::Vector2f(5.f, 6.f), sf::Vector2f(0.f, 0.f), sf::Color::White, sf::Time::Zero);
+
+        CHECK(particles.getParticleCount() == 2);
+        CHECK(particles.getParticlePosition(0) == sf::Vector2f(1.f, 2.f));
+        CHECK(particles.getParticlePosition(1) == sf::Vector2f(3.f, 4.f));
+        CHECK(particles.getParticleLifetime(1) == sf::seconds(2.f));
+
+        particles.clear();
+        CHECK(particles.getParticleCount() == 0);
+    }
+
+    SECTION("Update")
+    {
+        particles.setAcceleration(sf::Vector2f(0.f, 10.f));
+        particles.emit(sf::Vector2f(0.f, 0.f), sf::Vector2f(4.f, 0.f), sf::Color::White, sf::seconds(2.f));
+
+        // The velocity is updated before the position
+        particles.update(sf::seconds(0.5f));
+        CHECK(particles.getParticlePosition(0) == sf::Vector2f(2.f, 2.5f));
+        CHECK(particles.getParticleLifetime(0) == sf::seconds(1.5f));
+
+        particles.update(sf::seconds(0.5f));
+        CHECK(particles.getParticlePosition(0) == sf::Vector2f(4.f, 7.5f));
+        CHECK(particles.getParticleLifetime(0) == sf::seconds(1.f));
+    }
+
+    SECTION("Dead particles are removed in order")
+    {
+        for (int i = 0; i < 6; ++i)
+        {
+            sf::Time lifetime = sf::seconds((i % 2) ? 3.f : 1.f);
+            particles.emit(sf::Vector2f(static_cast<float>(i), 0.f), sf::Vector2f(0.f, 1.f), sf::Color::White, lifetime);
+        }
+
+        particles.update(sf::seconds(1.f));
+        REQUIRE(particles.getParticleCount() == 3);
+        CHECK(particles.getParticlePosition(0) == sf::Vector2f(1.f, 1.f));
+        CHECK(particles.getParticlePosition(1) == sf::Vector2f(3.f, 1.f));
+        CHECK(particles.getParticlePosition(2) == sf::Vector2f(5.f, 1.f));
+
+        particles.update(sf::seconds(2.f));
+        CHECK(particles.getParticleCount() == 0);
+    }
+
+    SECTION("Copies keep the particles")
+    {
+        particles.emit(sf::Vector2f(1.f, 2.f), sf::Vector2f(0.f, 0.f), sf::Color::White, sf::seconds(1.f));
+        particles.setRenderMode(sf::ParticleSystem::TexturedQuads);
+
+        sf::ParticleSystem copy(particles);
+        CHECK(copy.getParticleCount() == 1);
+        CHECK(copy.getParticlePosition(0) == sf::Vector2f(1.f, 2.f));
+        CHECK(copy.getRenderMode() == sf::ParticleSystem::TexturedQuads);
+
+        sf::ParticleSystem assigned;
+        assigned = particles;
+        CHECK(assigned.getParticleCount() == 1);
+        CHECK(assigned.getRenderMode() == sf::ParticleSystem::TexturedQuads);
+    }
+}
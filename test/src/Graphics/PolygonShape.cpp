@@ -0,0 +1,203 @@
+#include <SFML/Graphics/PolygonShape.hpp>
+#include "GraphicsUtil.hpp"
+#include <cmath>
+
+namespace
+{
+    void setPoints(sf::PolygonShape& shape, const sf::Vector2f* points, std::size_t count)
+    {
+        shape.setPointCount(count);
+        for (std::size_t i = 0; i < count; ++i)
+            shape.setPoint(i, points[i]);
+    }
+
+    // Twice the signed area of a triangle of the polygon
+    float getTriangleArea(const sf::PolygonShape& shape, std::size_t triangle)
+    {
+        sf::Vector2f a = shape.getTrianglePoint(triangle * 3);
+        sf::Vector2f b = shape.getTrianglePoint(triangle * 3 + 1);
+        sf::Vector2f c = shape.getTrianglePoint(triangle * 3 + 2);
+        return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    }
+
+    // Area covered by the triangles; triangles that overlap, or that are flipped
+    // because they cover the outside of the polygon, make it too large
+    float getTotalArea(const sf::PolygonShape& shape)
+    {
+        float area = 0.f;
+        for (std::size_t i = 0; i < shape.getTriangleCount(); ++i)
+            area += std::abs(getTriangleArea(shape, i)) / 2.f;
+        return area;
+    }
+
+    // Check that all the triangles have the same winding, degenerate ones aside
+    bool haveSameWinding(const sf::PolygonShape& shape)
+    {
+        bool positive = false;
+        bool negative = false;
+        for (std::size_t i = 0; i < shape.getTriangleCount(); ++i)
+        {
+            float area = getTriangleArea(shape, i);
+            positive = positive || (area > 0.f);
+            negative = negative || (area < 0.f);
+        }
+        return !(positive && negative);
+    }
+}
+
+TEST_CASE("sf::PolygonShape class", "[graphics]")
+{
+    sf::PolygonShape shape;
+
+    SECTION("Concave polygon")
+    {
+        // An L shape, whose reflex corner must not be clipped as an ear
+        sf::Vector2f points[] = {sf::Vector2f(0.f, 0.f), sf::Vector2f(100.f, 0.f), sf::Vector2f(100.f, 40.f),
+                                 sf::Vector2f(40.f, 40.f), sf::Vector2f(40.f, 100.f), sf::Vector2f(0.f, 100.f)};
+        setPoints(shape, points, 6);
+
+        CHECK(shape.getTriangleCount() == 4);
+        CHECK(getTotalArea(shape) == Approx(6400.f));
+        CHECK(haveSameWinding(shape));
+        CHECK(shape.getLocalBounds() == sf::FloatRect(0.f, 0.f, 100.f, 100.f));
+
+        // The same polygon given in the other direction
+        for (std::size_t i = 0; i < 6; ++i)
+            shape.setPoint(i, points[5 - i]);
+
+        CHECK(shape.getTriangleCount() == 4);
+        CHECK(getTotalArea(shape) == Approx(6400.f));
+        CHECK(haveSameWinding(shape));
+
+        // A comb with several reflex corners
+        sf::Vector2f comb[] = {sf::Vector2f(0.f, 0.f), sf::Vector2f(10.f, 0.f), sf::Vector2f(10.f, 50.f),
+                               sf::Vector2f(20.f, 50.f), sf::Vector2f(20.f, 0.f), sf::Vector2f(30.f, 0.f),
+                               sf::Vector2f(30.f, 50.f), sf::Vector2f(40.f, 50.f), sf::Vector2f(40.f, 0.f),
+                               sf::Vector2f(50.f, 0.f), sf::Vector2f(50.f, 60.f), sf::Vector2f(0.f, 60.f)};
+        setPoints(shape, comb, 12);
+
+        CHECK(shape.getTriangleCount() == 10);
+        CHECK(getTotalArea(shape) == Approx(3000.f - 2.f * 500.f));
+        CHECK(haveSameWinding(shape));
+    }
+
+    SECTION("Holes")
+    {
+        sf::Vector2f points[] = {sf::Vector2f(0.f, 0.f), sf::Vector2f(100.f, 0.f),
+                                 sf::Vector2f(100.f, 100.f), sf::Vector2f(0.f, 100.f)};
+        setPoints(shape, points, 4);
+
+        // Holes are accepted in either direction
+        sf::Vector2f square[] = {sf::Vector2f(10.f, 10.f), sf::Vector2f(30.f, 10.f),
+                                 sf::Vector2f(30.f, 30.f), sf::Vector2f(10.f, 30.f)};
+        sf::Vector2f triangle[] = {sf::Vector2f(60.f, 80.f), sf::Vector2f(90.f, 80.f), sf::Vector2f(75.f, 50.f)};
+        sf::Vector2f diamond[] = {sf::Vector2f(50.f, 20.f), sf::Vector2f(40.f, 30.f),
+                                  sf::Vector2f(50.f, 40.f), sf::Vector2f(60.f, 30.f)};
+        shape.addHole(square, 4);
+        shape.addHole(triangle, 3);
+        shape.addHole(diamond, 4);
+        CHECK(shape.getHoleCount() == 3);
+
+        // Each bridge to a hole adds two points to the boundary
+        CHECK(shape.getTriangleCount() == 4 + 4 + 3 + 4 + 2 * 3 - 2);
+        CHECK(getTotalArea(shape) == Approx(10000.f - 400.f - 450.f - 200.f));
+        CHECK(haveSameWinding(shape));
+
+        // The bounds only depend on the outer boundary
+        CHECK(shape.getLocalBounds() == sf::FloatRect(0.f, 0.f, 100.f, 100.f));
+
+        // A hole in a concave polygon, next to its reflex corner
+        sf::Vector2f concave[] = {sf::Vector2f(0.f, 0.f), sf::Vector2f(100.f, 0.f), sf::Vector2f(100.f, 40.f),
+                                  sf::Vector2f(40.f, 40.f), sf::Vector2f(40.f, 100.f), sf::Vector2f(0.f, 100.f)};
+        setPoints(shape, concave, 6);
+        shape.clearHoles();
+        CHECK(shape.getHoleCount() == 0);
+
+        sf::Vector2f hole[] = {sf::Vector2f(10.f, 50.f), sf::Vector2f(30.f, 50.f),
+                               sf::Vector2f(30.f, 70.f), sf::Vector2f(10.f, 70.f)};
+        shape.addHole(hole, 4);
+
+        CHECK(shape.getTriangleCount() == 6 + 4 + 2 - 2);
+        CHECK(getTotalArea(shape) == Approx(6400.f - 400.f));
+        CHECK(haveSameWinding(shape));
+    }
+
+    SECTION("Collinear and duplicate points")
+    {
+        // A square with points in the middle of its edges, and a repeated corner
+        sf::Vector2f points[] = {sf::Vector2f(0.f, 0.f), sf::Vector2f(50.f, 0.f), sf::Vector2f(100.f, 0.f),
+                                 sf::Vector2f(100.f, 0.f), sf::Vector2f(100.f, 50.f), sf::Vector2f(100.f, 100.f),
+                                 sf::Vector2f(50.f, 100.f), sf::Vector2f(0.f, 100.f), sf::Vector2f(0.f, 50.f)};
+        setPoints(shape, points, 9);
+
+        CHECK(shape.getTriangleCount() == 7);
+        CHECK(getTotalArea(shape) == Approx(10000.f));
+        CHECK(haveSameWinding(shape));
+
+        // A hole with a collinear point
+        sf::Vector2f hole[] = {sf::Vector2f(20.f, 20.f), sf::Vector2f(40.f, 20.f), sf::Vector2f(60.f, 20.f),
+                               sf::Vector2f(60.f, 40.f), sf::Vector2f(20.f, 40.f)};
+        shape.addHole(hole, 5);
+
+        CHECK(getTotalArea(shape) == Approx(10000.f - 800.f));
+        CHECK(haveSameWinding(shape));
+    }
+
+    SECTION("Degenerate input")
+    {
+        // Not enough points
+        CHECK(shape.getTriangleCount() == 0);
+        CHECK(shape.getLocalBounds() == sf::FloatRect());
+
+        shape.setPointCount(2);
+        shape.setPoint(1, sf::Vector2f(10.f, 10.f));
+        CHECK(shape.getTriangleCount() == 0);
+        CHECK(shape.getLocalBounds() == sf::FloatRect());
+
+        // Holes with less than three points are ignored
+        sf::Vector2f segment[] = {sf::Vector2f(1.f, 1.f), sf::Vector2f(2.f, 2.f)};
+        shape.addHole(segment, 2);
+        shape.addHole(NULL, 3);
+        CHECK(shape.getHoleCount() == 0);
+
+        // All the points on a line, or at the same position: the triangulation
+        // terminates and doesn't cover anything
+        sf::Vector2f line[] = {sf::Vector2f(0.f, 0.f), sf::Vector2f(10.f, 10.f), sf::Vector2f(20.f, 20.f),
+                               sf::Vector2f(30.f, 30.f), sf::Vector2f(15.f, 15.f)};
+        setPoints(shape, line, 5);
+        CHECK(shape.getTriangleCount() == 3);
+        CHECK(getTotalArea(shape) == Approx(0.f));
+        CHECK(shape.getLocalBounds() == sf::FloatRect(0.f, 0.f, 30.f, 30.f));
+
+        sf::Vector2f same[] = {sf::Vector2f(5.f, 5.f), sf::Vector2f(5.f, 5.f), sf::Vector2f(5.f, 5.f),
+                               sf::Vector2f(5.f, 5.f)};
+        setPoints(shape, same, 4);
+        CHECK(shape.getTriangleCount() == 2);
+        CHECK(getTotalArea(shape) == Approx(0.f));
+
+        // A hole outside of the polygon is not connected to it
+        sf::Vector2f points[] = {sf::Vector2f(0.f, 0.f), sf::Vector2f(10.f, 0.f), sf::Vector2f(10.f, 10.f)};
+        setPoints(shape, points, 3);
+
+        sf::Vector2f outside[] = {sf::Vector2f(20.f, 0.f), sf::Vector2f(30.f, 0.f), sf::Vector2f(30.f, 10.f)};
+        shape.addHole(outside, 3);
+        CHECK(shape.getTriangleCount() == 1);
+        CHECK(getTotalArea(shape) == Approx(50.f));
+    }
+
+    SECTION("Copies keep the triangulation")
+    {
+        sf::Vector2f points[] = {sf::Vector2f(0.f, 0.f), sf::Vector2f(10.f, 0.f),
+                                 sf::Vector2f(10.f, 10.f), sf::Vector2f(0.f, 10.f)};
+        setPoints(shape, points, 4);
+
+        sf::PolygonShape copy(shape);
+        CHECK(copy.getTriangleCount() == 2);
+        CHECK(getTotalArea(copy) == Approx(100.f));
+
+        sf::PolygonShape assigned;
+        assigned = copy;
+        CHECK(assigned.getTriangleCount() == 2);
+        CHECK(getTotalArea(assigned) == Approx(100.f));
+    }
+}
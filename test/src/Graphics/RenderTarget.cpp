@@ -0,0 +1,157 @@
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/CommandList.hpp>
+#include "GraphicsUtil.hpp"
+
+namespace
+{
+    // Render target without an OpenGL context, only its damage tracking is exercised
+    class DamageTarget : public sf::RenderTarget
+    {
+    public:
+
+        DamageTarget()
+        {
+            initialize();
+        }
+
+        virtual sf::Vector2u getSize() const
+        {
+            return sf::Vector2u(100, 100);
+        }
+
+        virtual bool setActive(bool)
+        {
+            return false;
+        }
+
+        void endFrame()
+        {
+            resetDamage();
+        }
+    };
+
+    void recordQuad(sf::CommandList& list, float left, float top, const sf::BlendMode& blendMode)
+    {
+        sf::Vertex quad[4];
+        quad[0].position = sf::Vector2f(left, top);
+        quad[1].position = sf::Vector2f(left + 10.f, top);
+        quad[2].position = sf::Vector2f(left + 10.f, top + 10.f);
+        quad[3].position = sf::Vector2f(left, top + 10.f);
+
+        list.draw(quad, 4, sf::Quads, blendMode);
+    }
+
+    bool isEmpty(const sf::IntRect& rect)
+    {
+        return (rect.width <= 0) || (rect.height <= 0);
+    }
+
+    bool contains(const sf::IntRect& outer, const sf::IntRect& inner)
+    {
+        return (outer.left <= inner.left) && (outer.top <= inner.top) &&
+               (outer.left + outer.width >= inner.left + inner.width) &&
+               (outer.top + outer.height >= inner.top + inner.height);
+    }
+}
+
+TEST_CASE("sf::RenderTarget partial redraw", "[graphics]")
+{
+    DamageTarget target;
+
+    SECTION("Disabled by default")
+    {
+        CHECK(!target.isPartialRedrawEnabled());
+
+        target.invalidate();
+        CHECK(isEmpty(target.getDamagedArea()));
+    }
+
+    SECTION("First frame is fully damaged")
+    {
+        target.setPartialRedrawEnabled(true);
+        CHECK(target.isPartialRedrawEnabled());
+        CHECK(target.getDamagedArea() == sf::IntRect(0, 0, 100, 100));
+
+        target.endFrame();
+        CHECK(isEmpty(target.getDamagedArea()));
+    }
+
+    SECTION("Invalidated areas are merged")
+    {
+        target.setPartialRedrawEnabled(true);
+        target.endFrame();
+
+        target.invalidate(sf::FloatRect(10.f, 10.f, 5.f, 5.f));
+        sf::IntRect damage = target.getDamagedArea();
+        CHECK(contains(damage, sf::IntRect(10, 10, 5, 5)));
+        CHECK(contains(sf::IntRect(8, 8, 9, 9), damage));
+
+        target.invalidate(sf::FloatRect(50.f, 60.f, 10.f, 10.f));
+        damage = target.getDamagedArea();
+        CHECK(contains(damage, sf::IntRect(10, 10, 50, 60)));
+
+        // Areas outside the target are clipped
+        target.endFrame();
+        target.invalidate(sf::FloatRect(-50.f, -50.f, 20.f, 20.f));
+        CHECK(isEmpty(target.getDamagedArea()));
+    }
+
+    SECTION("Unchanged command lists don't damage the target")
+    {
+        // Different blend modes keep the two quads in separate commands
+        sf::CommandList list(target.getSize());
+        recordQuad(list, 10.f, 10.f, sf::BlendAdd);
+        recordQuad(list, 50.f, 50.f, sf::BlendAlpha);
+
+        target.setPartialRedrawEnabled(true);
+        target.submit(list);
+        target.endFrame();
+
+        target.submit(list);
+        CHECK(isEmpty(target.getDamagedArea()));
+        target.endFrame();
+
+        // Moving a quad damages both its previous and its new location
+        list.reset();
+        recordQuad(list, 10.f, 10.f, sf::BlendAdd);
+        recordQuad(list, 70.f, 70.f, sf::BlendAlpha);
+        target.submit(list);
+
+        sf::IntRect damage = target.getDamagedArea();
+        CHECK(contains(damage, sf::IntRect(50, 50, 30, 30)));
+        CHECK(!contains(damage, sf::IntRect(10, 10, 10, 10)));
+    }
+
+    SECTION("Each submitted list is compared to the same one of the previous frame")
+    {
+        sf::CommandList first(target.getSize());
+        recordQuad(first, 10.f, 10.f, sf::BlendAlpha);
+
+        sf::CommandList second(target.getSize());
+        recordQuad(second, 50.f, 50.f, sf::BlendAdd);
+        recordQuad(second, 70.f, 70.f, sf::BlendAlpha);
+
+        target.setPartialRedrawEnabled(true);
+        target.submit(first);
+        target.submit(second);
+        target.endFrame();
+
+        target.submit(first);
+        target.submit(second);
+        CHECK(isEmpty(target.getDamagedArea()));
+        target.endFrame();
+
+        target.submit(first);
+        target.submit(second);
+        CHECK(isEmpty(target.getDamagedArea()));
+        target.endFrame();
+
+        // A list submitted at a new position has nothing to be compared to
+        target.submit(first);
+        target.submit(second);
+        target.submit(first);
+        sf::IntRect damage = target.getDamagedArea();
+        CHECK(contains(damage, sf::IntRect(10, 10, 10, 10)));
+        CHECK(!contains(damage, sf::IntRect(50, 50, 10, 10)));
+    }
+}
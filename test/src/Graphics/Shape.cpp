@@ -0,0 +1,65 @@
+#include <SFML/Graphics/ConvexShape.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include "GraphicsUtil.hpp"
+
+TEST_CASE("sf::Shape class", "[graphics]")
+{
+    SECTION("Bounds follow the geometry")
+    {
+        sf::RectangleShape shape(sf::Vector2f(10.f, 20.f));
+        CHECK(shape.getLocalBounds() == sf::FloatRect(0.f, 0.f, 10.f, 20.f));
+
+        shape.setSize(sf::Vector2f(30.f, 5.f));
+        CHECK(shape.getLocalBounds() == sf::FloatRect(0.f, 0.f, 30.f, 5.f));
+
+        shape.setOutlineThickness(2.f);
+        CHECK(shape.getLocalBounds() == sf::FloatRect(-2.f, -2.f, 34.f, 9.f));
+
+        shape.setOutlineThickness(0.f);
+        CHECK(shape.getLocalBounds() == sf::FloatRect(0.f, 0.f, 30.f, 5.f));
+    }
+
+    SECTION("Outline on a shape without enough points")
+    {
+        sf::ConvexShape shape(2);
+        shape.setPoint(1, sf::Vector2f(10.f, 10.f));
+        shape.setOutlineThickness(3.f);
+        shape.setFillColor(sf::Color::Red);
+        CHECK(shape.getLocalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Outline joins")
+    {
+        // Triangle with a very sharp corner at (100, 0)
+        sf::ConvexShape shape(3);
+        shape.setPoint(0, sf::Vector2f(0.f, 0.f));
+        shape.setPoint(1, sf::Vector2f(100.f, 0.f));
+        shape.setPoint(2, sf::Vector2f(0.f, 5.f));
+        shape.setOutlineThickness(1.f);
+
+        // The default miter limit bevels the sharp corner
+        CHECK(shape.getOutlineJoin() == sf::Shape::MiterJoin);
+        CHECK(shape.getLocalBounds().left + shape.getLocalBounds().width < 102.f);
+
+        shape.setMiterLimit(100.f);
+        CHECK(shape.getLocalBounds().left + shape.getLocalBounds().width > 130.f);
+
+        // The arc of the round join stays within the outline thickness
+        shape.setOutlineJoin(sf::Shape::RoundJoin);
+        CHECK(shape.getLocalBounds().left + shape.getLocalBounds().width > 100.5f);
+        CHECK(shape.getLocalBounds().left + shape.getLocalBounds().width <= 101.f);
+    }
+
+    SECTION("Edge fringe")
+    {
+        sf::RectangleShape shape(sf::Vector2f(10.f, 20.f));
+        shape.setEdgeFringe(1.f);
+        CHECK(shape.getLocalBounds() == sf::FloatRect(-1.f, -1.f, 12.f, 22.f));
+
+        shape.setOutlineThickness(2.f);
+        CHECK(shape.getLocalBounds() == sf::FloatRect(-3.f, -3.f, 16.f, 26.f));
+
+        shape.setEdgeFringe(0.f);
+        CHECK(shape.getLocalBounds() == sf::FloatRect(-2.f, -2.f, 14.f, 24.f));
+    }
+}
@@ -0,0 +1,94 @@
+#include <SFML/Graphics/SpatialIndex.hpp>
+#include <SFML/Graphics/View.hpp>
+#include "GraphicsUtil.hpp"
+
+TEST_CASE("sf::SpatialIndex class", "[graphics]")
+{
+    SECTION("Construction")
+    {
+        sf::SpatialIndex index;
+        CHECK(index.getObjectCount() == 0);
+
+        std::vector<std::size_t> result;
+        CHECK(index.query(sf::FloatRect(0.f, 0.f, 100.f, 100.f), result) == 0);
+        CHECK(result.empty());
+    }
+
+    SECTION("Insertion and query")
+    {
+        sf::SpatialIndex index(10.f);
+        std::size_t a = index.insert(sf::FloatRect(0.f, 0.f, 5.f, 5.f));
+        std::size_t b = index.insert(sf::FloatRect(-95.f, 40.f, 5.f, 5.f));
+        std::size_t c = index.insert(sf::FloatRect(8.f, 8.f, 4.f, 4.f));
+        std::size_t d = index.insert(sf::FloatRect(-1000.f, -1000.f, 2000.f, 2000.f));
+
+        CHECK(index.getObjectCount() == 4);
+        CHECK(index.getBounds(b) == sf::FloatRect(-95.f, 40.f, 5.f, 5.f));
+        CHECK(index.getDrawable(a) == NULL);
+
+        std::vector<std::size_t> result;
+        CHECK(index.query(sf::FloatRect(0.f, 0.f, 7.f, 7.f), result) == 2);
+        REQUIRE(result.size() == 2);
+        CHECK(result[0] == a);
+        CHECK(result[1] == d);
+
+        // Object extending past the cell of its center
+        result.clear();
+        CHECK(index.query(sf::FloatRect(11.f, 11.f, 1.f, 1.f), result) == 2);
+        REQUIRE(result.size() == 2);
+        CHECK(result[0] == c);
+        CHECK(result[1] == d);
+
+        // Area covering more cells than the index has
+        result.clear();
+        CHECK(index.query(sf::FloatRect(-500.f, -500.f, 1000.f, 1000.f), result) == 4);
+    }
+
+    SECTION("Update and removal")
+    {
+        sf::SpatialIndex index(10.f);
+        std::size_t a = index.insert(sf::FloatRect(0.f, 0.f, 5.f, 5.f));
+        std::size_t b = index.insert(sf::FloatRect(1.f, 1.f, 5.f, 5.f));
+
+        index.update(a, sf::FloatRect(100.f, 100.f, 5.f, 5.f));
+
+        std::vector<std::size_t> result;
+        CHECK(index.query(sf::FloatRect(0.f, 0.f, 5.f, 5.f), result) == 1);
+        CHECK(result[0] == b);
+
+        result.clear();
+        CHECK(index.query(sf::FloatRect(100.f, 100.f, 5.f, 5.f), result) == 1);
+        CHECK(result[0] == a);
+
+        index.remove(b);
+        CHECK(index.getObjectCount() == 1);
+
+        result.clear();
+        CHECK(index.query(sf::FloatRect(0.f, 0.f, 5.f, 5.f), result) == 0);
+
+        // Identifiers are reused
+        CHECK(index.insert(sf::FloatRect(0.f, 0.f, 1.f, 1.f)) == b);
+
+        index.clear();
+        CHECK(index.getObjectCount() == 0);
+    }
+
+    SECTION("View queries")
+    {
+        sf::View view(sf::Vector2f(0.f, 0.f), sf::Vector2f(100.f, 50.f));
+        CHECK(sf::SpatialIndex::getViewBounds(view) == sf::FloatRect(-50.f, -25.f, 100.f, 50.f));
+
+        sf::SpatialIndex index(10.f);
+        index.insert(sf::FloatRect(40.f, 0.f, 5.f, 5.f));
+        index.insert(sf::FloatRect(0.f, 40.f, 5.f, 5.f));
+
+        std::vector<std::size_t> result;
+        CHECK(index.query(view, result) == 1);
+
+        // Rotating the view by 90 degrees swaps the visible extents
+        view.setRotation(90.f);
+        result.clear();
+        CHECK(index.query(view, result) == 1);
+        CHECK(result[0] == 1);
+    }
+}
@@ -0,0 +1,93 @@
+#include <SFML/Graphics/TileMap.hpp>
+#include <SFML/Graphics/View.hpp>
+#include "GraphicsUtil.hpp"
+
+TEST_CASE("sf::TileMap class", "[graphics]")
+{
+    sf::TileMap map;
+    map.create(sf::Vector2u(70, 40), sf::Vector2u(16, 16), 32);
+
+    SECTION("Chunking")
+    {
+        CHECK(map.getSize() == sf::Vector2u(70, 40));
+        CHECK(map.getTileSize() == sf::Vector2u(16, 16));
+        CHECK(map.getChunkCount() == sf::Vector2u(3, 2));
+        CHECK(map.getLocalBounds() == sf::FloatRect(0.f, 0.f, 1120.f, 640.f));
+
+        // Chunks on the right and bottom edges only cover the remaining cells
+        CHECK(map.getChunkVertexCount(0, 0) == 32 * 32 * 6);
+        CHECK(map.getChunkVertexCount(2, 0) == 6 * 32 * 6);
+        CHECK(map.getChunkVertexCount(0, 1) == 32 * 8 * 6);
+        CHECK(map.getChunkVertexCount(2, 1) == 6 * 8 * 6);
+
+        CHECK(map.getTile(69, 39) == sf::TileMap::EmptyTile);
+    }
+
+    SECTION("Changing a tile updates its vertices in its chunk")
+    {
+        // Without a tileset, each row of the tileset holds a single tile
+        map.setTile(33, 5, 7);
+        CHECK(map.getTile(33, 5) == 7);
+
+        const sf::Vertex* vertices = map.getChunkVertices(1, 0) + (5 * 32 + 1) * 6;
+        CHECK(vertices[0].position == sf::Vector2f(528.f, 80.f));
+        CHECK(vertices[5].position == sf::Vector2f(544.f, 96.f));
+        CHECK(vertices[0].texCoords == sf::Vector2f(0.f, 112.f));
+        CHECK(vertices[5].texCoords == sf::Vector2f(16.f, 128.f));
+        CHECK(vertices[0].color == sf::Color::White);
+
+        // The last cell of the last chunk
+        map.setTile(69, 39, 1);
+        vertices = map.getChunkVertices(2, 1) + (7 * 6 + 5) * 6;
+        CHECK(vertices[0].position == sf::Vector2f(1104.f, 624.f));
+        CHECK(vertices[5].position == sf::Vector2f(1120.f, 640.f));
+
+        // Emptying a cell makes its triangles degenerate
+        map.setTile(33, 5, sf::TileMap::EmptyTile);
+        vertices = map.getChunkVertices(1, 0) + (5 * 32 + 1) * 6;
+        CHECK(vertices[0].position == vertices[5].position);
+    }
+
+    SECTION("Animated tiles keep their color")
+    {
+        map.setTile(0, 0, 4);
+        map.setTileAnimation(4, 3);
+        map.setAnimationFrame(5);
+
+        // Frame 5 modulo 3 is two tiles to the right of the first frame
+        const sf::Vertex* vertices = map.getChunkVertices(0, 0);
+        CHECK(vertices[0].texCoords == sf::Vector2f(32.f, 64.f));
+        CHECK(vertices[0].color == sf::Color::White);
+
+        map.setAnimationFrame(6);
+        CHECK(vertices[0].texCoords == sf::Vector2f(0.f, 64.f));
+
+        map.setTileAnimation(4, 1);
+        CHECK(vertices[0].texCoords == sf::Vector2f(0.f, 64.f));
+    }
+
+    SECTION("Only the chunks in view are drawn")
+    {
+        sf::View view(sf::FloatRect(0.f, 0.f, 100.f, 100.f));
+        CHECK(map.getVisibleChunks(view) == sf::IntRect(0, 0, 1, 1));
+
+        // A view straddling the four chunks around a corner
+        view.setCenter(512.f, 512.f);
+        CHECK(map.getVisibleChunks(view) == sf::IntRect(0, 0, 2, 2));
+
+        // Chunks outside of the map are ignored
+        view.setCenter(1100.f, 600.f);
+        CHECK(map.getVisibleChunks(view) == sf::IntRect(2, 1, 1, 1));
+
+        view.setCenter(-100.f, 0.f);
+        CHECK(map.getVisibleChunks(view).width == 0);
+
+        // The transforms of the map and of the render states move it into view
+        map.setPosition(-200.f, 0.f);
+        CHECK(map.getVisibleChunks(view) == sf::IntRect(0, 0, 1, 1));
+
+        sf::Transform transform;
+        transform.translate(-600.f, 0.f);
+        CHECK(map.getVisibleChunks(view, transform) == sf::IntRect(1, 0, 1, 1));
+    }
+}
@@ -0,0 +1,60 @@
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include "GraphicsUtil.hpp"
+#include <vector>
+
+namespace
+{
+    std::vector<sf::Vertex> makeVertices(std::size_t count)
+    {
+        std::vector<sf::Vertex> vertices(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float value = static_cast<float>(i);
+            vertices[i] = sf::Vertex(sf::Vector2f(value * 3.f - 7.f, 11.f - value * 0.5f),
+                                     sf::Color(static_cast<sf::Uint8>(i), 20, 30, 40),
+                                     sf::Vector2f(value, value * 2.f));
+        }
+        return vertices;
+    }
+}
+
+TEST_CASE("sf::Transform class", "[graphics]")
+{
+    sf::Transform transform;
+    transform.translate(10.f, -20.f).rotate(30.f).scale(2.f, 0.5f);
+
+    SECTION("transformPoints() matches transformPoint()")
+    {
+        for (std::size_t count = 0; count <= 9; ++count)
+        {
+            std::vector<sf::Vertex> input = makeVertices(count);
+            std::vector<sf::Vertex> output(count);
+            transform.transformPoints(count ? &input[0] : NULL, count ? &output[0] : NULL, count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sf::Vector2f expected = transform.transformPoint(input[i].position);
+                CHECK(output[i].position.x == Approx(expected.x));
+                CHECK(output[i].position.y == Approx(expected.y));
+                CHECK(output[i].color == input[i].color);
+                CHECK(output[i].texCoords == input[i].texCoords);
+            }
+        }
+    }
+
+    SECTION("transformPoints() in place")
+    {
+        std::vector<sf::Vertex> vertices = makeVertices(5);
+        std::vector<sf::Vertex> original = vertices;
+        transform.transformPoints(&vertices[0], &vertices[0], vertices.size());
+
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+        {
+            sf::Vector2f expected = transform.transformPoint(original[i].position);
+            CHECK(vertices[i].position.x == Approx(expected.x));
+            CHECK(vertices[i].position.y == Approx(expected.y));
+            CHECK(vertices[i].texCoords == original[i].texCoords);
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#include <SFML/Graphics/VertexArray.hpp>
+#include "GraphicsUtil.hpp"
+
+TEST_CASE("sf::VertexArray class", "[graphics]")
+{
+    SECTION("Empty bounds")
+    {
+        sf::VertexArray array;
+        CHECK(array.getBounds() == sf::FloatRect());
+    }
+
+    SECTION("Bounds extended by append and resize")
+    {
+        sf::VertexArray array(sf::Points);
+        array.append(sf::Vertex(sf::Vector2f(10.f, 20.f)));
+        CHECK(array.getBounds() == sf::FloatRect(10.f, 20.f, 0.f, 0.f));
+
+        array.append(sf::Vertex(sf::Vector2f(-5.f, 30.f)));
+        array.append(sf::Vertex(sf::Vector2f(3.f, 25.f)));
+        CHECK(array.getBounds() == sf::FloatRect(-5.f, 20.f, 15.f, 10.f));
+
+        // New vertices are at the origin
+        array.resize(4);
+        CHECK(array.getBounds() == sf::FloatRect(-5.f, 0.f, 15.f, 30.f));
+    }
+
+    SECTION("Bounds updated after modification")
+    {
+        sf::VertexArray array(sf::Triangles, 5);
+        for (std::size_t i = 0; i < array.getVertexCount(); ++i)
+            array[i].position = sf::Vector2f(static_cast<float>(i), static_cast<float>(i) * -2.f);
+        CHECK(array.getBounds() == sf::FloatRect(0.f, -8.f, 4.f, 8.f));
+
+        array[2].position = sf::Vector2f(100.f, 50.f);
+        CHECK(array.getBounds() == sf::FloatRect(0.f, -8.f, 100.f, 58.f));
+
+        array.resize(2);
+        CHECK(array.getBounds() == sf::FloatRect(0.f, -2.f, 1.f, 2.f));
+
+        array.clear();
+        CHECK(array.getBounds() == sf::FloatRect());
+    }
+}
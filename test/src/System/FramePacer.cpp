@@ -0,0 +1,64 @@
+#include <SFML/System/FramePacer.hpp>
+#include "SystemUtil.hpp"
+
+TEST_CASE("sf::FramePacer class", "[system]")
+{
+    SECTION("Construction")
+    {
+        sf::FramePacer pacer;
+        CHECK(pacer.getFrameTime() == sf::Time::Zero);
+        CHECK(pacer.getStatistics().frameCount == 0);
+        CHECK(pacer.getStatistics().missedDeadlineCount == 0);
+        CHECK(pacer.getSleepMargin() > sf::Time::Zero);
+    }
+
+    SECTION("Measuring without pacing")
+    {
+        sf::FramePacer pacer;
+        pacer.wait();
+        pacer.wait();
+
+        const sf::FramePacer::Statistics& statistics = pacer.getStatistics();
+        CHECK(statistics.frameCount == 2);
+        CHECK(statistics.missedDeadlineCount == 0);
+        CHECK(statistics.minFrameTime <= statistics.maxFrameTime);
+
+        pacer.resetStatistics();
+        CHECK(pacer.getStatistics().frameCount == 0);
+    }
+
+    SECTION("Pacing")
+    {
+        const sf::Time frameTime = sf::milliseconds(5);
+        const int frameCount = 10;
+
+        sf::Clock clock;
+        sf::FramePacer pacer(frameTime);
+        for (int i = 0; i < frameCount; ++i)
+            pacer.wait();
+
+        // Deadlines are cumulative, the loop can't end before the last one
+        CHECK(clock.getElapsedTime() >= frameTime * static_cast<float>(frameCount));
+
+        const sf::FramePacer::Statistics& statistics = pacer.getStatistics();
+        CHECK(statistics.frameCount == static_cast<sf::Uint64>(frameCount));
+        CHECK(statistics.totalFrameTime >= frameTime * static_cast<float>(frameCount));
+
+        sf::Uint64 histogramCount = 0;
+        for (std::size_t i = 0; i < sf::FramePacer::HistogramSize; ++i)
+            histogramCount += statistics.histogram[i];
+        CHECK(histogramCount == statistics.frameCount);
+    }
+
+    SECTION("Missed deadlines")
+    {
+        sf::FramePacer pacer(sf::milliseconds(1));
+        sf::Clock clock;
+        while (clock.getElapsedTime() < sf::milliseconds(3))
+        {
+        }
+
+        pacer.wait();
+        CHECK(pacer.getStatistics().missedDeadlineCount == 1);
+    }
+}
@@ -0,0 +1,121 @@
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/InputSnapshot.hpp>
+#include "WindowUtil.hpp"
+
+TEST_CASE("sf::InputSnapshot class", "[window]")
+{
+    sf::InputSnapshot snapshot;
+    sf::Event event;
+
+    SECTION("Construction")
+    {
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::A));
+        CHECK(!snapshot.isButtonPressed(sf::Mouse::Left));
+        CHECK(snapshot.getMousePosition() == sf::Vector2i(0, 0));
+        CHECK(!snapshot.isMouseInside());
+        CHECK(!snapshot.hasFocus());
+        CHECK(!snapshot.isJoystickConnected(0));
+    }
+
+    SECTION("Keyboard")
+    {
+        event.type = sf::Event::KeyPressed;
+        event.key.code = sf::Keyboard::Space;
+        snapshot.update(event);
+        CHECK(snapshot.isKeyPressed(sf::Keyboard::Space));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Enter));
+
+        event.type = sf::Event::KeyReleased;
+        snapshot.update(event);
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Space));
+
+        // Unknown keys are ignored
+        event.type = sf::Event::KeyPressed;
+        event.key.code = sf::Keyboard::Unknown;
+        snapshot.update(event);
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Unknown));
+    }
+
+    SECTION("Mouse")
+    {
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = 10;
+        event.mouseMove.y = 20;
+        snapshot.update(event);
+        CHECK(snapshot.getMousePosition() == sf::Vector2i(10, 20));
+
+        event.type = sf::Event::MouseButtonPressed;
+        event.mouseButton.button = sf::Mouse::Right;
+        event.mouseButton.x = 30;
+        event.mouseButton.y = 40;
+        snapshot.update(event);
+        CHECK(snapshot.isButtonPressed(sf::Mouse::Right));
+        CHECK(snapshot.getMousePosition() == sf::Vector2i(30, 40));
+
+        event.type = sf::Event::MouseEntered;
+        snapshot.update(event);
+        CHECK(snapshot.isMouseInside());
+
+        event.type = sf::Event::MouseLeft;
+        snapshot.update(event);
+        CHECK(!snapshot.isMouseInside());
+    }
+
+    SECTION("Focus")
+    {
+        event.type = sf::Event::GainedFocus;
+        snapshot.update(event);
+        CHECK(snapshot.hasFocus());
+
+        event.type = sf::Event::KeyPressed;
+        event.key.code = sf::Keyboard::A;
+        snapshot.update(event);
+        event.type = sf::Event::MouseButtonPressed;
+        event.mouseButton.button = sf::Mouse::Left;
+        snapshot.update(event);
+        event.type = sf::Event::JoystickButtonPressed;
+        event.joystickButton.joystickId = 1;
+        event.joystickButton.button = 3;
+        snapshot.update(event);
+
+        // Key and mouse button releases are not reported while the window doesn't have the focus
+        event.type = sf::Event::LostFocus;
+        snapshot.update(event);
+        CHECK(!snapshot.hasFocus());
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::A));
+        CHECK(!snapshot.isButtonPressed(sf::Mouse::Left));
+
+        // Joysticks keep reporting their events without the focus
+        CHECK(snapshot.isJoystickButtonPressed(1, 3));
+    }
+
+    SECTION("Joysticks")
+    {
+        event.type = sf::Event::JoystickConnected;
+        event.joystickConnect.joystickId = 2;
+        snapshot.update(event);
+        CHECK(snapshot.isJoystickConnected(2));
+        CHECK(!snapshot.isJoystickConnected(sf::Joystick::Count));
+
+        event.type = sf::Event::JoystickButtonPressed;
+        event.joystickButton.joystickId = 2;
+        event.joystickButton.button = 5;
+        snapshot.update(event);
+        CHECK(snapshot.isJoystickButtonPressed(2, 5));
+
+        event.type = sf::Event::JoystickMoved;
+        event.joystickMove.joystickId = 2;
+        event.joystickMove.axis = sf::Joystick::Y;
+        event.joystickMove.position = -50.f;
+        snapshot.update(event);
+        CHECK(snapshot.getJoystickAxisPosition(2, sf::Joystick::Y) == -50.f);
+
+        // Disconnecting a joystick clears its state
+        event.type = sf::Event::JoystickDisconnected;
+        event.joystickConnect.joystickId = 2;
+        snapshot.update(event);
+        CHECK(!snapshot.isJoystickConnected(2));
+        CHECK(!snapshot.isJoystickButtonPressed(2, 5));
+        CHECK(snapshot.getJoystickAxisPosition(2, sf::Joystick::Y) == 0.f);
+    }
+}